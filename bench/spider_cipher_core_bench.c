@@ -0,0 +1,237 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "spider_cipher_core.h"
+#include "spider_cipher_batch.h"
+#include "spider_cipher_cache.h"
+#include "spider_cipher_random.h"
+
+//
+// Cards/sec of the per-card loop (as shown in spider_cipher_core.h)
+// against SpiderCipherScrambleBuffer, the cards-only
+// SpiderCipherLazyScrambleBuffer and the rotation offset
+// SpiderCipherRotatedScrambleBuffer, for each available engine.
+// The 32 lane SpiderCipherDeckBatch scrambles n/32 cards per lane
+// (lane 0 must agree with the start of the per-card loop).
+//
+// Last decks/sec of SpiderCipherDeckInitBy from 40 key cards against
+// SpiderCipherDeckInitFromArray and a SpiderCipherDeckCache hit on the
+// same cards, and fresh decks/sec of SpiderCipherRandomizeDecks
+// (getrandom entropy).
+//
+// This is built as a separate translation unit from the core, so the
+// per-card loop pays the same call overhead a caller would.
+//
+
+#define CARDS SPIDER_CIPHER_CARDS
+#define BENCH_CARDS (1024*1024)
+#define BENCH_TRIALS 5
+#define BENCH_DECKS (256*1024)
+#define BENCH_RANDOM_DECKS (16*1024)
+
+static double now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+static SpiderCipherCard key(uint8_t at, void *misc) {
+  return (7*at+3) % CARDS;
+}
+
+static void scrambleLoop(SpiderCipherDeck *deck,
+			 const SpiderCipherCard *in,
+			 SpiderCipherCard *out,
+			 size_t n) {
+  SpiderCipherDeck spare;
+  SpiderCipherDeckInit(&spare);
+  for (size_t i=0; i<n; ++i) {
+    SpiderCipherCard clear = in[i];
+    out[i] = SpiderCipherScramble(deck,clear);
+    SpiderCipherAdvanceDeck(deck,clear,&spare);
+  }
+  SpiderCipherDeckInit(&spare);
+}
+
+static void lazyScrambleBuffer(SpiderCipherDeck *deck,
+			       const SpiderCipherCard *in,
+			       SpiderCipherCard *out,
+			       size_t n) {
+  SpiderCipherLazyDeck lazy;
+  SpiderCipherLazyDeckFrom(&lazy,deck);
+  SpiderCipherLazyScrambleBuffer(&lazy,in,out,n);
+  SpiderCipherDeckFromLazy(deck,&lazy);
+  SpiderCipherLazyDeckInit(&lazy);
+}
+
+static void rotatedScrambleBuffer(SpiderCipherDeck *deck,
+				  const SpiderCipherCard *in,
+				  SpiderCipherCard *out,
+				  size_t n) {
+  SpiderCipherRotatedDeck rotated;
+  SpiderCipherRotatedDeckFrom(&rotated,deck);
+  SpiderCipherRotatedScrambleBuffer(&rotated,in,out,n);
+  SpiderCipherDeckFromRotated(deck,&rotated);
+  SpiderCipherRotatedDeckInit(&rotated);
+}
+
+static void batchScrambleBuffer(SpiderCipherDeck *deck,
+				const SpiderCipherCard *in,
+				SpiderCipherCard *out,
+				size_t n) {
+  SpiderCipherDeckBatch batch;
+  const SpiderCipherCard *ins[SPIDER_CIPHER_BATCH_LANES];
+  SpiderCipherCard *outs[SPIDER_CIPHER_BATCH_LANES];
+  size_t m = n/SPIDER_CIPHER_BATCH_LANES;
+  SpiderCipherDeckBatchInit(&batch,SPIDER_CIPHER_BATCH_LANES);
+  for (int lane=0; lane<SPIDER_CIPHER_BATCH_LANES; ++lane) {
+    SpiderCipherDeckBatchSet(&batch,lane,deck);
+    ins[lane] = in+lane*m;
+    outs[lane] = out+lane*m;
+  }
+  SpiderCipherBatchScrambleBuffer(&batch,ins,outs,m);
+  SpiderCipherDeckBatchInit(&batch,SPIDER_CIPHER_BATCH_LANES);
+}
+
+static double best(void (*scramble)(SpiderCipherDeck *deck,
+				    const SpiderCipherCard *in,
+				    SpiderCipherCard *out,
+				    size_t n),
+		   const SpiderCipherCard *in,
+		   SpiderCipherCard *out,
+		   size_t n) {
+  double rate = 0;
+  for (int trial=0; trial<BENCH_TRIALS; ++trial) {
+    SpiderCipherDeck deck;
+    SpiderCipherDeckInitBy(&deck,key,NULL);
+    double t0 = now();
+    scramble(&deck,in,out,n);
+    double t1 = now();
+    if (n/(t1-t0) > rate) rate = n/(t1-t0);
+  }
+  return rate;
+}
+
+static SpiderCipherDeckCache cache;
+
+static SpiderCipherCard keyAt(uint8_t at, void *misc) {
+  return ((SpiderCipherCard*) misc)[at];
+}
+
+#define DECKS_INIT_BY 0
+#define DECKS_FROM_ARRAY 1
+#define DECKS_CACHED 2
+
+static double bestDecks(int how) {
+  SpiderCipherCard cards[CARDS];
+  double rate = 0;
+  for (uint8_t at=0; at<CARDS; ++at) {
+    cards[at] = key(at,NULL);
+  }
+  SpiderCipherDeckCacheInit(&cache);
+  for (int trial=0; trial<BENCH_TRIALS; ++trial) {
+    SpiderCipherDeck deck;
+    int ok = 1;
+    double t0 = now();
+    for (size_t i=0; i<BENCH_DECKS; ++i) {
+      if (how == DECKS_CACHED) {
+	ok &= SpiderCipherDeckCacheGet(&cache,cards,&deck);
+      } else if (how == DECKS_FROM_ARRAY) {
+	ok &= SpiderCipherDeckInitFromArray(&deck,cards);
+      } else {
+	ok &= SpiderCipherDeckInitBy(&deck,keyAt,cards);
+      }
+    }
+    double t1 = now();
+    if (!ok) return 0;
+    if (BENCH_DECKS/(t1-t0) > rate) rate = BENCH_DECKS/(t1-t0);
+  }
+  SpiderCipherDeckCacheInit(&cache);
+  return rate;
+}
+
+static SpiderCipherDeck randomDecks[BENCH_RANDOM_DECKS];
+
+static double bestRandomDecks() {
+  SpiderCipherEntropy entropy;
+  double rate = 0;
+  SpiderCipherEntropyInit(&entropy);
+  for (int trial=0; trial<BENCH_TRIALS; ++trial) {
+    double t0 = now();
+    for (size_t i=0; i<BENCH_RANDOM_DECKS; ++i) {
+      SpiderCipherDeckInit(&randomDecks[i]);
+    }
+    size_t made = SpiderCipherRandomizeDecks(randomDecks,BENCH_RANDOM_DECKS,&entropy);
+    double t1 = now();
+    if (made != BENCH_RANDOM_DECKS) return 0;
+    if (BENCH_RANDOM_DECKS/(t1-t0) > rate) rate = BENCH_RANDOM_DECKS/(t1-t0);
+  }
+  SpiderCipherEntropyFinish(&entropy);
+  return rate;
+}
+
+int main(int argc, const char *argv[]) {
+  size_t n = BENCH_CARDS;
+  SpiderCipherCard *in = (SpiderCipherCard*) malloc(n);
+  SpiderCipherCard *loop = (SpiderCipherCard*) malloc(n);
+  SpiderCipherCard *buffer = (SpiderCipherCard*) malloc(n);
+  SpiderCipherCard *lazy = (SpiderCipherCard*) malloc(n);
+  SpiderCipherCard *rotated = (SpiderCipherCard*) malloc(n);
+  SpiderCipherCard *batch = (SpiderCipherCard*) malloc(n);
+  if (in == NULL || loop == NULL || buffer == NULL ||
+      lazy == NULL || rotated == NULL || batch == NULL) return 1;
+
+  for (size_t i=0; i<n; ++i) {
+    in[i] = (i*i+i/CARDS) % CARDS;
+  }
+
+  const char *names[] = { "auto", "scalar", "sse4.1", "avx2", "table" };
+  int same = 1;
+  for (int engine = SPIDER_CIPHER_ENGINE_SCALAR;
+       engine <= SPIDER_CIPHER_ENGINE_TABLE; ++engine) {
+    if (!SpiderCipherEngineSelect(engine)) continue;
+
+    double loopRate = best(scrambleLoop,in,loop,n);
+    double bufferRate = best(SpiderCipherScrambleBuffer,in,buffer,n);
+    double lazyRate = best(lazyScrambleBuffer,in,lazy,n);
+    double rotatedRate = best(rotatedScrambleBuffer,in,rotated,n);
+    double batchRate = best(batchScrambleBuffer,in,batch,n);
+
+    printf("%-6s per-card loop: %12.0f cards/sec\n",names[engine],loopRate);
+    printf("%-6s buffer:        %12.0f cards/sec (%.2fx)\n",
+	   names[engine],bufferRate,bufferRate/loopRate);
+    printf("%-6s lazy buffer:   %12.0f cards/sec (%.2fx)\n",
+	   names[engine],lazyRate,lazyRate/loopRate);
+    printf("%-6s rotated buffer:%12.0f cards/sec (%.2fx)\n",
+	   names[engine],rotatedRate,rotatedRate/loopRate);
+    printf("%-6s batch of 32:   %12.0f cards/sec (%.2fx)\n",
+	   names[engine],batchRate,batchRate/loopRate);
+
+    if (memcmp(loop,buffer,n) != 0 || memcmp(loop,lazy,n) != 0 ||
+	memcmp(loop,rotated,n) != 0 ||
+	memcmp(loop,batch,n/SPIDER_CIPHER_BATCH_LANES) != 0) {
+      printf("%s buffers and per-card loop disagree!\n",names[engine]);
+      same = 0;
+    }
+  }
+
+  double initRate = bestDecks(DECKS_INIT_BY);
+  double arrayRate = bestDecks(DECKS_FROM_ARRAY);
+  double cacheRate = bestDecks(DECKS_CACHED);
+  printf("deck init by:         %12.0f decks/sec\n",initRate);
+  printf("deck init from array: %12.0f decks/sec (%.2fx)\n",
+	 arrayRate,arrayRate/initRate);
+  printf("deck cache hit:       %12.0f decks/sec (%.2fx)\n",
+	 cacheRate,cacheRate/initRate);
+  printf("random decks:         %12.0f decks/sec\n",bestRandomDecks());
+
+  free(in);
+  free(loop);
+  free(buffer);
+  free(lazy);
+  free(rotated);
+  free(batch);
+  return same ? 0 : 1;
+}
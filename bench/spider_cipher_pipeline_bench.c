@@ -0,0 +1,100 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "spider_cipher_pipeline.h"
+
+//
+// Packets/sec of SpiderCipherPipeline against the number of worker
+// threads (1, 2, 4, ... up to twice the online cpus), each packet
+// with its own key.
+//
+
+#define CARDS SPIDER_CIPHER_CARDS
+#define BENCH_PACKETS 4096
+#define BENCH_PACKET 1024
+#define BENCH_TRIALS 5
+#define BENCH_DONE 64
+
+static double now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+static SpiderCipherCard key(uint8_t at, void *misc) {
+  size_t k = *(size_t*) misc;
+  // 7 and 40 are coprime, so this is a deck for every k.
+  return (7*at+3+k) % CARDS;
+}
+
+static double best(int threads,
+		   SpiderCipherPipelineJob *jobs,
+		   size_t count) {
+  double rate = 0;
+  SpiderCipherPipeline *pipeline = SpiderCipherPipelineNew(threads);
+  if (pipeline == NULL) return 0;
+  for (int trial=0; trial<BENCH_TRIALS; ++trial) {
+    SpiderCipherPipelineJob *done[BENCH_DONE];
+    double t0 = now();
+    SpiderCipherPipelineSubmit(pipeline,jobs,count);
+    while (SpiderCipherPipelineComplete(pipeline,done,BENCH_DONE) > 0);
+    double t1 = now();
+    if (count/(t1-t0) > rate) rate = count/(t1-t0);
+  }
+  SpiderCipherPipelineFree(pipeline);
+  return rate;
+}
+
+int main(int argc, const char *argv[]) {
+  size_t count = BENCH_PACKETS;
+  size_t *keys = (size_t*) malloc(count*sizeof(size_t));
+  SpiderCipherCard *in = (SpiderCipherCard*) malloc(count*BENCH_PACKET);
+  SpiderCipherCard *out = (SpiderCipherCard*) malloc(count*BENCH_PACKET);
+  SpiderCipherCard *expect = (SpiderCipherCard*) malloc(BENCH_PACKET);
+  SpiderCipherPipelineJob *jobs =
+    (SpiderCipherPipelineJob*) malloc(count*sizeof(SpiderCipherPipelineJob));
+  if (keys == NULL || in == NULL || out == NULL ||
+      expect == NULL || jobs == NULL) return 1;
+
+  for (size_t j=0; j<count; ++j) {
+    keys[j] = j;
+    for (size_t i=0; i<BENCH_PACKET; ++i) {
+      in[j*BENCH_PACKET+i] = (i*i+j) % CARDS;
+    }
+    jobs[j].key = key;
+    jobs[j].misc = &keys[j];
+    jobs[j].in = in+j*BENCH_PACKET;
+    jobs[j].out = out+j*BENCH_PACKET;
+    jobs[j].n = BENCH_PACKET;
+    jobs[j].unscramble = 0;
+  }
+
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  if (cpus < 1) cpus = 1;
+  double one = 0;
+  printf("%d packets of %d cards, %ld cpus\n",BENCH_PACKETS,BENCH_PACKET,cpus);
+  for (int threads=1; threads <= 2*cpus; threads *= 2) {
+    double rate = best(threads,jobs,count);
+    if (threads == 1) one = rate;
+    printf("threads %3d: %10.0f packets/sec (%.2fx)\n",threads,rate,rate/one);
+  }
+
+  int same = 1;
+  for (size_t j=0; j<count; j += count/16) {
+    SpiderCipherDeck deck;
+    SpiderCipherDeckInitBy(&deck,key,&keys[j]);
+    SpiderCipherScrambleBuffer(&deck,in+j*BENCH_PACKET,expect,BENCH_PACKET);
+    if (memcmp(expect,out+j*BENCH_PACKET,BENCH_PACKET) != 0) same = 0;
+  }
+  if (!same) printf("pipeline and buffer disagree!\n");
+
+  free(keys);
+  free(in);
+  free(out);
+  free(expect);
+  free(jobs);
+  return same ? 0 : 1;
+}
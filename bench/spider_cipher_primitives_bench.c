@@ -0,0 +1,332 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "spider_cipher_core.h"
+#include "spider_cipher_packed.h"
+#include "spider_cipher_rank.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <x86intrin.h>
+#define BENCH_TSC 1
+#else
+#define BENCH_TSC 0
+#endif
+
+//
+// Per-primitive timings for tracking regressions between releases:
+//
+//   bin/spider_cipher_primitives_bench [--json=file]
+//
+// Every primitive runs over 1, 16, 256, 4K and 1M cards (calls for
+// the deck inits), after a warmup, for a number of trials.  Each
+// trial gives ns/card (clock_gettime) and cycles/card (rdtsc, which
+// counts reference cycles at the nominal rate, not turbo); the
+// median and 99th percentile over the trials are reported.  The
+// median cost of timing an empty trial is subtracted first, so the
+// small sizes are not mostly clock_gettime.
+//
+// --json=file also writes the results as JSON.
+//
+
+#define CARDS SPIDER_CIPHER_CARDS
+#define BENCH_MAX (1024*1024)
+#define BENCH_BUDGET (4*1024*1024)
+#define BENCH_TRIALS_MIN 11
+#define BENCH_TRIALS_MAX 201
+#define BENCH_WARMUP 3
+
+typedef SpiderCipherDeck Deck;
+typedef SpiderCipherCard Card;
+
+static double now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+static unsigned long long cycles() {
+#if BENCH_TSC
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+static Card key(uint8_t at, void *misc) {
+  return (7*at+3) % CARDS;
+}
+
+//
+// Each primitive runs n times from the shared state below and
+// leaves something in sink, so nothing is optimized away.
+//
+
+static Card *in;
+static Card *out;
+static uint8_t *packedIn;
+static uint8_t *packedOut;
+static Card keyCards[CARDS];
+static Deck deck;
+static Deck spare;
+static uint8_t rank[SPIDER_CIPHER_RANK_BYTES];
+static volatile unsigned sink;
+
+static void benchDeckInit(size_t n) {
+  for (size_t i=0; i<n; ++i) {
+    SpiderCipherDeckInit(&deck);
+    sink += deck.cards[i % CARDS];
+  }
+}
+
+static void benchDeckInitBy(size_t n) {
+  for (size_t i=0; i<n; ++i) {
+    sink += SpiderCipherDeckInitBy(&deck,key,NULL);
+  }
+}
+
+static void benchDeckInitFromArray(size_t n) {
+  for (size_t i=0; i<n; ++i) {
+    sink += SpiderCipherDeckInitFromArray(&deck,keyCards);
+  }
+}
+
+static void benchScramble(size_t n) {
+  for (size_t i=0; i<n; ++i) {
+    out[i] = SpiderCipherScramble(&deck,in[i]);
+  }
+}
+
+static void benchUnscramble(size_t n) {
+  for (size_t i=0; i<n; ++i) {
+    out[i] = SpiderCipherUnscramble(&deck,in[i]);
+  }
+}
+
+static void benchAdvanceDeck(size_t n) {
+  for (size_t i=0; i<n; ++i) {
+    SpiderCipherAdvanceDeck(&deck,in[i],&spare);
+  }
+}
+
+static void benchScrambleLoop(size_t n) {
+  for (size_t i=0; i<n; ++i) {
+    Card clear = in[i];
+    out[i] = SpiderCipherScramble(&deck,clear);
+    SpiderCipherAdvanceDeck(&deck,clear,&spare);
+  }
+}
+
+static void benchScrambleBuffer(size_t n) {
+  SpiderCipherScrambleBuffer(&deck,in,out,n);
+}
+
+static void benchUnscrambleBuffer(size_t n) {
+  SpiderCipherUnscrambleBuffer(&deck,in,out,n);
+}
+
+static void benchPack(size_t n) {
+  SpiderCipherPack(in,packedOut,n);
+}
+
+static void benchUnpack(size_t n) {
+  sink += SpiderCipherUnpack(packedIn,out,n);
+}
+
+static void benchScramblePacked(size_t n) {
+  SpiderCipherScramblePacked(&deck,packedIn,packedOut,n);
+}
+
+static void benchRank(size_t n) {
+  for (size_t i=0; i<n; ++i) {
+    SpiderCipherRank(&deck,rank);
+    sink += rank[i % SPIDER_CIPHER_RANK_BYTES];
+  }
+}
+
+static void benchUnrank(size_t n) {
+  for (size_t i=0; i<n; ++i) {
+    sink += SpiderCipherUnrank(&spare,rank);
+  }
+}
+
+typedef struct {
+  const char *name;
+  void (*run)(size_t n);
+} Primitive;
+
+static const Primitive primitives[] = {
+  { "deck_init", benchDeckInit },
+  { "deck_init_by", benchDeckInitBy },
+  { "deck_init_from_array", benchDeckInitFromArray },
+  { "scramble", benchScramble },
+  { "unscramble", benchUnscramble },
+  { "advance_deck", benchAdvanceDeck },
+  { "scramble_advance_loop", benchScrambleLoop },
+  { "scramble_buffer", benchScrambleBuffer },
+  { "unscramble_buffer", benchUnscrambleBuffer },
+  { "pack", benchPack },
+  { "unpack", benchUnpack },
+  { "scramble_packed", benchScramblePacked },
+  { "rank", benchRank },
+  { "unrank", benchUnrank },
+};
+
+static const size_t sizes[] = { 1, 16, 256, 4*1024, BENCH_MAX };
+
+#define PRIMITIVES (sizeof(primitives)/sizeof(primitives[0]))
+#define SIZES (sizeof(sizes)/sizeof(sizes[0]))
+
+typedef struct {
+  double median;
+  double p99;
+} Stats;
+
+typedef struct {
+  const char *name;
+  size_t cards;
+  int trials;
+  Stats ns;
+  Stats cycles;
+} Result;
+
+static int doubleCmp(const void *a, const void *b) {
+  double x = *(const double*) a, y = *(const double*) b;
+  return x < y ? -1 : x > y ? 1 : 0;
+}
+
+static Stats stats(double *samples, int count) {
+  Stats s;
+  qsort(samples,count,sizeof(double),doubleCmp);
+  s.median = samples[count/2];
+  s.p99 = samples[(count*99+99)/100-1];
+  return s;
+}
+
+static void benchNothing(size_t n) {
+}
+
+static const Primitive nothing = { "nothing", benchNothing };
+
+// median cost of an empty trial.
+static double overheadNs = 0;
+static double overheadCycles = 0;
+
+static Result measure(const Primitive *primitive, size_t n) {
+  double ns[BENCH_TRIALS_MAX];
+  double cy[BENCH_TRIALS_MAX];
+  Result result;
+  int trials = BENCH_BUDGET/n;
+  if (trials < BENCH_TRIALS_MIN) trials = BENCH_TRIALS_MIN;
+  if (trials > BENCH_TRIALS_MAX) trials = BENCH_TRIALS_MAX;
+
+  SpiderCipherDeckInitBy(&deck,key,NULL);
+  for (int w=0; w<BENCH_WARMUP; ++w) {
+    primitive->run(n);
+  }
+  for (int trial=0; trial<trials; ++trial) {
+    SpiderCipherDeckInitBy(&deck,key,NULL);
+    double t0 = now();
+    unsigned long long c0 = cycles();
+    primitive->run(n);
+    unsigned long long c1 = cycles();
+    double t1 = now();
+    ns[trial] = ((t1-t0)*1e9-overheadNs)/n;
+    cy[trial] = ((double) (c1-c0)-overheadCycles)/n;
+  }
+
+  result.name = primitive->name;
+  result.cards = n;
+  result.trials = trials;
+  result.ns = stats(ns,trials);
+  result.cycles = stats(cy,trials);
+  return result;
+}
+
+static const char *engineName(int engine) {
+  switch (engine) {
+  case SPIDER_CIPHER_ENGINE_SCALAR: return "scalar";
+  case SPIDER_CIPHER_ENGINE_SSE41: return "sse4.1";
+  case SPIDER_CIPHER_ENGINE_AVX2: return "avx2";
+  case SPIDER_CIPHER_ENGINE_TABLE: return "table";
+  }
+  return "unknown";
+}
+
+static int writeJson(const char *file, Result *results, int count) {
+  FILE *f = fopen(file,"w");
+  if (f == NULL) return 0;
+  fprintf(f,"{\n  \"engine\": \"%s\",\n  \"tsc\": %s,\n"
+	  "  \"timer_ns\": %.3f,\n  \"timer_cycles\": %.3f,\n  \"results\": [\n",
+	  engineName(SpiderCipherEngine()),BENCH_TSC ? "true" : "false",
+	  overheadNs,overheadCycles);
+  for (int i=0; i<count; ++i) {
+    Result *r = &results[i];
+    fprintf(f,"    {\"name\": \"%s\", \"cards\": %zu, \"trials\": %d, "
+	    "\"ns_per_card\": {\"median\": %.3f, \"p99\": %.3f}, "
+	    "\"cycles_per_card\": {\"median\": %.3f, \"p99\": %.3f}}%s\n",
+	    r->name,r->cards,r->trials,r->ns.median,r->ns.p99,
+	    r->cycles.median,r->cycles.p99,i+1<count ? "," : "");
+  }
+  fprintf(f,"  ]\n}\n");
+  return fclose(f) == 0;
+}
+
+int main(int argc, const char *argv[]) {
+  const char *json = NULL;
+  for (int argi=1; argi<argc; ++argi) {
+    if (strncmp(argv[argi],"--json=",7) == 0) {
+      json = argv[argi]+7;
+    } else {
+      fprintf(stderr,"usage: %s [--json=file]\n",argv[0]);
+      return 1;
+    }
+  }
+
+  in = (Card*) malloc(BENCH_MAX);
+  out = (Card*) malloc(BENCH_MAX);
+  packedIn = (uint8_t*) malloc(SPIDER_CIPHER_PACKED_BYTES(BENCH_MAX));
+  packedOut = (uint8_t*) malloc(SPIDER_CIPHER_PACKED_BYTES(BENCH_MAX));
+  if (in == NULL || out == NULL || packedIn == NULL || packedOut == NULL) return 1;
+  for (size_t i=0; i<BENCH_MAX; ++i) {
+    in[i] = (i*i+i/CARDS) % CARDS;
+  }
+  SpiderCipherPack(in,packedIn,BENCH_MAX);
+  for (uint8_t at=0; at<CARDS; ++at) {
+    keyCards[at] = key(at,NULL);
+  }
+  SpiderCipherDeckInit(&spare);
+
+  Result empty = measure(&nothing,1);
+  overheadNs = empty.ns.median;
+  overheadCycles = empty.cycles.median;
+
+  static Result results[PRIMITIVES*SIZES];
+  int count = 0;
+  printf("engine %s, ns/card and %s/card (median p99), timer %.0f ns\n",
+	 engineName(SpiderCipherEngine()),BENCH_TSC ? "tsc cycles" : "(no tsc)",
+	 overheadNs);
+  for (size_t p=0; p<PRIMITIVES; ++p) {
+    for (size_t s=0; s<SIZES; ++s) {
+      Result r = measure(&primitives[p],sizes[s]);
+      printf("%-22s %8zu %9.2f %9.2f ns %9.2f %9.2f cycles\n",
+	     r.name,r.cards,r.ns.median,r.ns.p99,r.cycles.median,r.cycles.p99);
+      results[count++] = r;
+    }
+  }
+
+  int ok = 1;
+  if (json != NULL && !writeJson(json,results,count)) {
+    fprintf(stderr,"could not write %s\n",json);
+    ok = 0;
+  }
+
+  SpiderCipherDeckInit(&deck);
+  SpiderCipherDeckInit(&spare);
+  free(in);
+  free(out);
+  free(packedIn);
+  free(packedOut);
+  return ok ? 0 : 1;
+}
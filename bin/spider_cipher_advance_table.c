@@ -0,0 +1,1687 @@
+// generated by tools/spider_cipher_advance_table_gen.c, do not edit.
+
+#include <stdint.h>
+
+const uint8_t SPIDER_CIPHER_ADVANCE_TABLE[40][40][40] =
+  {
+   {
+    {39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38},
+    {37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39},
+    {35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37},
+    {33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35},
+    {31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33},
+    {29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31},
+    {27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29},
+    {25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27},
+    {23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25},
+    {21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23},
+    {19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21},
+    {17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19},
+    {15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17},
+    {13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15},
+    {11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13},
+    {9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11},
+    {7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9},
+    {5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7},
+    {3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5},
+    {1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3},
+    {0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1},
+    {2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0},
+    {4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2},
+    {6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4},
+    {8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6},
+    {10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8},
+    {12,14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10},
+    {14,16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12},
+    {16,18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14},
+    {18,20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16},
+    {20,22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18},
+    {22,24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20},
+    {24,26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22},
+    {26,28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24},
+    {28,30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26},
+    {30,32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28},
+    {32,34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30},
+    {34,36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32},
+    {36,38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34},
+    {38,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36}
+   },
+   {
+    {0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39},
+    {38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0},
+    {36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38},
+    {34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36},
+    {32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34},
+    {30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32},
+    {28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30},
+    {26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28},
+    {24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26},
+    {22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24},
+    {20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22},
+    {18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20},
+    {16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18},
+    {14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16},
+    {12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14},
+    {10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12},
+    {8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10},
+    {6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8},
+    {4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6},
+    {2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4},
+    {1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2},
+    {3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1},
+    {5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3},
+    {7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5},
+    {9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7},
+    {11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9},
+    {13,15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11},
+    {15,17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13},
+    {17,19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15},
+    {19,21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17},
+    {21,23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19},
+    {23,25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21},
+    {25,27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23},
+    {27,29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25},
+    {29,31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27},
+    {31,33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29},
+    {33,35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31},
+    {35,37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33},
+    {37,39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35},
+    {39,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37}
+   },
+   {
+    {1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0},
+    {39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1},
+    {37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39},
+    {35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37},
+    {33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35},
+    {31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33},
+    {29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31},
+    {27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29},
+    {25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27},
+    {23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25},
+    {21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23},
+    {19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21},
+    {17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19},
+    {15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17},
+    {13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15},
+    {11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13},
+    {9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11},
+    {7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9},
+    {5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7},
+    {3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5},
+    {2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3},
+    {4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2},
+    {6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4},
+    {8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6},
+    {10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8},
+    {12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10},
+    {14,16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12},
+    {16,18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14},
+    {18,20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16},
+    {20,22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18},
+    {22,24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20},
+    {24,26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22},
+    {26,28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24},
+    {28,30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26},
+    {30,32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28},
+    {32,34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30},
+    {34,36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32},
+    {36,38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34},
+    {38,0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36},
+    {0,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38}
+   },
+   {
+    {2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1},
+    {0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2},
+    {38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0},
+    {36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38},
+    {34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36},
+    {32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34},
+    {30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32},
+    {28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30},
+    {26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28},
+    {24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26},
+    {22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24},
+    {20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22},
+    {18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20},
+    {16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18},
+    {14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16},
+    {12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14},
+    {10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12},
+    {8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10},
+    {6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8},
+    {4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6},
+    {3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4},
+    {5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3},
+    {7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5},
+    {9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7},
+    {11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9},
+    {13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11},
+    {15,17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13},
+    {17,19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15},
+    {19,21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17},
+    {21,23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19},
+    {23,25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21},
+    {25,27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23},
+    {27,29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25},
+    {29,31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27},
+    {31,33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29},
+    {33,35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31},
+    {35,37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33},
+    {37,39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35},
+    {39,1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37},
+    {1,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39}
+   },
+   {
+    {3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2},
+    {1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3},
+    {39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1},
+    {37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39},
+    {35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37},
+    {33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35},
+    {31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33},
+    {29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31},
+    {27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29},
+    {25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27},
+    {23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25},
+    {21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23},
+    {19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21},
+    {17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19},
+    {15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17},
+    {13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15},
+    {11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13},
+    {9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11},
+    {7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9},
+    {5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7},
+    {4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5},
+    {6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4},
+    {8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6},
+    {10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8},
+    {12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10},
+    {14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12},
+    {16,18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14},
+    {18,20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16},
+    {20,22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18},
+    {22,24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20},
+    {24,26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22},
+    {26,28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24},
+    {28,30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26},
+    {30,32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28},
+    {32,34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30},
+    {34,36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32},
+    {36,38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34},
+    {38,0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36},
+    {0,2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38},
+    {2,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0}
+   },
+   {
+    {4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3},
+    {2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4},
+    {0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2},
+    {38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0},
+    {36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38},
+    {34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36},
+    {32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34},
+    {30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32},
+    {28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30},
+    {26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28},
+    {24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26},
+    {22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24},
+    {20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22},
+    {18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20},
+    {16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18},
+    {14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16},
+    {12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14},
+    {10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12},
+    {8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10},
+    {6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8},
+    {5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6},
+    {7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5},
+    {9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7},
+    {11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9},
+    {13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11},
+    {15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13},
+    {17,19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15},
+    {19,21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17},
+    {21,23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19},
+    {23,25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21},
+    {25,27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23},
+    {27,29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25},
+    {29,31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27},
+    {31,33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29},
+    {33,35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31},
+    {35,37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33},
+    {37,39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35},
+    {39,1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37},
+    {1,3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39},
+    {3,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1}
+   },
+   {
+    {5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4},
+    {3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5},
+    {1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3},
+    {39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1},
+    {37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39},
+    {35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37},
+    {33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35},
+    {31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33},
+    {29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31},
+    {27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29},
+    {25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27},
+    {23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25},
+    {21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23},
+    {19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21},
+    {17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19},
+    {15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17},
+    {13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15},
+    {11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13},
+    {9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11},
+    {7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9},
+    {6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7},
+    {8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6},
+    {10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8},
+    {12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10},
+    {14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12},
+    {16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14},
+    {18,20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16},
+    {20,22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18},
+    {22,24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20},
+    {24,26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22},
+    {26,28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24},
+    {28,30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26},
+    {30,32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28},
+    {32,34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30},
+    {34,36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32},
+    {36,38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34},
+    {38,0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36},
+    {0,2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38},
+    {2,4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0},
+    {4,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2}
+   },
+   {
+    {6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5},
+    {4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6},
+    {2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4},
+    {0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2},
+    {38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0},
+    {36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38},
+    {34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36},
+    {32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34},
+    {30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32},
+    {28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30},
+    {26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28},
+    {24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26},
+    {22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24},
+    {20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22},
+    {18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20},
+    {16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18},
+    {14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16},
+    {12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14},
+    {10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12},
+    {8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10},
+    {7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8},
+    {9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7},
+    {11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9},
+    {13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11},
+    {15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13},
+    {17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15},
+    {19,21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17},
+    {21,23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19},
+    {23,25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21},
+    {25,27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23},
+    {27,29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25},
+    {29,31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27},
+    {31,33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29},
+    {33,35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31},
+    {35,37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33},
+    {37,39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35},
+    {39,1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37},
+    {1,3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39},
+    {3,5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1},
+    {5,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3}
+   },
+   {
+    {7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6},
+    {5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7},
+    {3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5},
+    {1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3},
+    {39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1},
+    {37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39},
+    {35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37},
+    {33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35},
+    {31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33},
+    {29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31},
+    {27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29},
+    {25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27},
+    {23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25},
+    {21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23},
+    {19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21},
+    {17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19},
+    {15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17},
+    {13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15},
+    {11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13},
+    {9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11},
+    {8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9},
+    {10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8},
+    {12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10},
+    {14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12},
+    {16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14},
+    {18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16},
+    {20,22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18},
+    {22,24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20},
+    {24,26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22},
+    {26,28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24},
+    {28,30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26},
+    {30,32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28},
+    {32,34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30},
+    {34,36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32},
+    {36,38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34},
+    {38,0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36},
+    {0,2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38},
+    {2,4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0},
+    {4,6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2},
+    {6,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4}
+   },
+   {
+    {8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7},
+    {6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8},
+    {4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6},
+    {2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4},
+    {0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2},
+    {38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0},
+    {36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38},
+    {34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36},
+    {32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34},
+    {30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32},
+    {28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30},
+    {26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28},
+    {24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26},
+    {22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24},
+    {20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22},
+    {18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20},
+    {16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18},
+    {14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16},
+    {12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14},
+    {10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12},
+    {9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10},
+    {11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9},
+    {13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11},
+    {15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13},
+    {17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15},
+    {19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17},
+    {21,23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19},
+    {23,25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21},
+    {25,27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23},
+    {27,29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25},
+    {29,31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27},
+    {31,33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29},
+    {33,35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31},
+    {35,37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33},
+    {37,39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35},
+    {39,1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37},
+    {1,3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39},
+    {3,5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1},
+    {5,7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3},
+    {7,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5}
+   },
+   {
+    {9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8},
+    {7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9},
+    {5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7},
+    {3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5},
+    {1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3},
+    {39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1},
+    {37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39},
+    {35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37},
+    {33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35},
+    {31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33},
+    {29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31},
+    {27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29},
+    {25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27},
+    {23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25},
+    {21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23},
+    {19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21},
+    {17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19},
+    {15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17},
+    {13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15},
+    {11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13},
+    {10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11},
+    {12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10},
+    {14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12},
+    {16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14},
+    {18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16},
+    {20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18},
+    {22,24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20},
+    {24,26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22},
+    {26,28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24},
+    {28,30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26},
+    {30,32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28},
+    {32,34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30},
+    {34,36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32},
+    {36,38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34},
+    {38,0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36},
+    {0,2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38},
+    {2,4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0},
+    {4,6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2},
+    {6,8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4},
+    {8,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,11,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6}
+   },
+   {
+    {10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9},
+    {8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10},
+    {6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8},
+    {4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6},
+    {2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4},
+    {0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2},
+    {38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0},
+    {36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38},
+    {34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36},
+    {32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34},
+    {30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32},
+    {28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30},
+    {26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28},
+    {24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26},
+    {22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24},
+    {20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22},
+    {18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20},
+    {16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18},
+    {14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16},
+    {12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14},
+    {11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12},
+    {13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11},
+    {15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13},
+    {17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15},
+    {19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17},
+    {21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19},
+    {23,25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21},
+    {25,27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23},
+    {27,29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25},
+    {29,31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27},
+    {31,33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29},
+    {33,35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31},
+    {35,37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33},
+    {37,39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35},
+    {39,1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37},
+    {1,3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39},
+    {3,5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1},
+    {5,7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3},
+    {7,9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5},
+    {9,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,12,11,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7}
+   },
+   {
+    {11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10},
+    {9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11},
+    {7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9},
+    {5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7},
+    {3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5},
+    {1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3},
+    {39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1},
+    {37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39},
+    {35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37},
+    {33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35},
+    {31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33},
+    {29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31},
+    {27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29},
+    {25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27},
+    {23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25},
+    {21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23},
+    {19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21},
+    {17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19},
+    {15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17},
+    {13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15},
+    {12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13},
+    {14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12},
+    {16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14},
+    {18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16},
+    {20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18},
+    {22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20},
+    {24,26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22},
+    {26,28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24},
+    {28,30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26},
+    {30,32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28},
+    {32,34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30},
+    {34,36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32},
+    {36,38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34},
+    {38,0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36},
+    {0,2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38},
+    {2,4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0},
+    {4,6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2},
+    {6,8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4},
+    {8,10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6},
+    {10,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,13,12,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8}
+   },
+   {
+    {12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11},
+    {10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12},
+    {8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10},
+    {6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8},
+    {4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6},
+    {2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4},
+    {0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2},
+    {38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0},
+    {36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38},
+    {34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36},
+    {32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34},
+    {30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32},
+    {28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30},
+    {26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28},
+    {24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26},
+    {22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24},
+    {20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22},
+    {18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20},
+    {16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18},
+    {14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16},
+    {13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14},
+    {15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13},
+    {17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15},
+    {19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17},
+    {21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19},
+    {23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21},
+    {25,27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23},
+    {27,29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25},
+    {29,31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27},
+    {31,33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29},
+    {33,35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31},
+    {35,37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33},
+    {37,39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35},
+    {39,1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37},
+    {1,3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39},
+    {3,5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1},
+    {5,7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3},
+    {7,9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5},
+    {9,11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7},
+    {11,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,14,13,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9}
+   },
+   {
+    {13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12},
+    {11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13},
+    {9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11},
+    {7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9},
+    {5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7},
+    {3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5},
+    {1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3},
+    {39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1},
+    {37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39},
+    {35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37},
+    {33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35},
+    {31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33},
+    {29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31},
+    {27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29},
+    {25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27},
+    {23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25},
+    {21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23},
+    {19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21},
+    {17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19},
+    {15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17},
+    {14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15},
+    {16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14},
+    {18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16},
+    {20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18},
+    {22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20},
+    {24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22},
+    {26,28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24},
+    {28,30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26},
+    {30,32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28},
+    {32,34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30},
+    {34,36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32},
+    {36,38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34},
+    {38,0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36},
+    {0,2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38},
+    {2,4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0},
+    {4,6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2},
+    {6,8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4},
+    {8,10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6},
+    {10,12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8},
+    {12,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,15,14,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10}
+   },
+   {
+    {14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13},
+    {12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14},
+    {10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12},
+    {8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10},
+    {6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8},
+    {4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6},
+    {2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4},
+    {0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2},
+    {38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0},
+    {36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38},
+    {34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36},
+    {32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34},
+    {30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32},
+    {28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30},
+    {26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28},
+    {24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26},
+    {22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24},
+    {20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22},
+    {18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20},
+    {16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18},
+    {15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16},
+    {17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15},
+    {19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17},
+    {21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19},
+    {23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21},
+    {25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23},
+    {27,29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25},
+    {29,31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27},
+    {31,33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29},
+    {33,35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31},
+    {35,37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33},
+    {37,39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35},
+    {39,1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37},
+    {1,3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39},
+    {3,5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1},
+    {5,7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3},
+    {7,9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5},
+    {9,11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7},
+    {11,13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9},
+    {13,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,16,15,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11}
+   },
+   {
+    {15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14},
+    {13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15},
+    {11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13},
+    {9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11},
+    {7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9},
+    {5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7},
+    {3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5},
+    {1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3},
+    {39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1},
+    {37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39},
+    {35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37},
+    {33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35},
+    {31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33},
+    {29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31},
+    {27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29},
+    {25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27},
+    {23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25},
+    {21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23},
+    {19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21},
+    {17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19},
+    {16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17},
+    {18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16},
+    {20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18},
+    {22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20},
+    {24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22},
+    {26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24},
+    {28,30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26},
+    {30,32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28},
+    {32,34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30},
+    {34,36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32},
+    {36,38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34},
+    {38,0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36},
+    {0,2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38},
+    {2,4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0},
+    {4,6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2},
+    {6,8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4},
+    {8,10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6},
+    {10,12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8},
+    {12,14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10},
+    {14,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,17,16,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12}
+   },
+   {
+    {16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15},
+    {14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16},
+    {12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14},
+    {10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12},
+    {8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10},
+    {6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8},
+    {4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6},
+    {2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4},
+    {0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2},
+    {38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0},
+    {36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38},
+    {34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36},
+    {32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34},
+    {30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32},
+    {28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30},
+    {26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28},
+    {24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26},
+    {22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24},
+    {20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22},
+    {18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20},
+    {17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18},
+    {19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17},
+    {21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19},
+    {23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21},
+    {25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23},
+    {27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25},
+    {29,31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27},
+    {31,33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29},
+    {33,35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31},
+    {35,37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33},
+    {37,39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35},
+    {39,1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37},
+    {1,3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39},
+    {3,5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1},
+    {5,7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3},
+    {7,9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5},
+    {9,11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7},
+    {11,13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9},
+    {13,15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11},
+    {15,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,18,17,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13}
+   },
+   {
+    {17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16},
+    {15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17},
+    {13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15},
+    {11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13},
+    {9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11},
+    {7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9},
+    {5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7},
+    {3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5},
+    {1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3},
+    {39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1},
+    {37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39},
+    {35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37},
+    {33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35},
+    {31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33},
+    {29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31},
+    {27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29},
+    {25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27},
+    {23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25},
+    {21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23},
+    {19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21},
+    {18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19},
+    {20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18},
+    {22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20},
+    {24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22},
+    {26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24},
+    {28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26},
+    {30,32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28},
+    {32,34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30},
+    {34,36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32},
+    {36,38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34},
+    {38,0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36},
+    {0,2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38},
+    {2,4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0},
+    {4,6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2},
+    {6,8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4},
+    {8,10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6},
+    {10,12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8},
+    {12,14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10},
+    {14,16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12},
+    {16,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,19,18,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14}
+   },
+   {
+    {18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17},
+    {16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18},
+    {14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16},
+    {12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14},
+    {10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12},
+    {8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10},
+    {6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8},
+    {4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6},
+    {2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4},
+    {0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2},
+    {38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0},
+    {36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38},
+    {34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36},
+    {32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34},
+    {30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32},
+    {28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30},
+    {26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28},
+    {24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26},
+    {22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24},
+    {20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22},
+    {19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20},
+    {21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19},
+    {23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21},
+    {25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23},
+    {27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25},
+    {29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27},
+    {31,33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29},
+    {33,35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31},
+    {35,37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33},
+    {37,39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35},
+    {39,1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37},
+    {1,3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39},
+    {3,5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1},
+    {5,7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3},
+    {7,9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5},
+    {9,11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7},
+    {11,13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9},
+    {13,15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11},
+    {15,17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13},
+    {17,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,20,19,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15}
+   },
+   {
+    {19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18},
+    {17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19},
+    {15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17},
+    {13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15},
+    {11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13},
+    {9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11},
+    {7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9},
+    {5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7},
+    {3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5},
+    {1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3},
+    {39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1},
+    {37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39},
+    {35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37},
+    {33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35},
+    {31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33},
+    {29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31},
+    {27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29},
+    {25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27},
+    {23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25},
+    {21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23},
+    {20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21},
+    {22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20},
+    {24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22},
+    {26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24},
+    {28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26},
+    {30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28},
+    {32,34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30},
+    {34,36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32},
+    {36,38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34},
+    {38,0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36},
+    {0,2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38},
+    {2,4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0},
+    {4,6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2},
+    {6,8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4},
+    {8,10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6},
+    {10,12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8},
+    {12,14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10},
+    {14,16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12},
+    {16,18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14},
+    {18,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,21,20,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16}
+   },
+   {
+    {20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19},
+    {18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20},
+    {16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18},
+    {14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16},
+    {12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14},
+    {10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12},
+    {8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10},
+    {6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8},
+    {4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6},
+    {2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4},
+    {0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2},
+    {38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0},
+    {36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38},
+    {34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36},
+    {32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34},
+    {30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32},
+    {28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30},
+    {26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28},
+    {24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26},
+    {22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24},
+    {21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22},
+    {23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21},
+    {25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23},
+    {27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25},
+    {29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27},
+    {31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29},
+    {33,35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31},
+    {35,37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33},
+    {37,39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35},
+    {39,1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37},
+    {1,3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39},
+    {3,5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1},
+    {5,7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3},
+    {7,9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5},
+    {9,11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7},
+    {11,13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9},
+    {13,15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11},
+    {15,17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13},
+    {17,19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15},
+    {19,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,22,21,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17}
+   },
+   {
+    {21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20},
+    {19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21},
+    {17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19},
+    {15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17},
+    {13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15},
+    {11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13},
+    {9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11},
+    {7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9},
+    {5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7},
+    {3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5},
+    {1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3},
+    {39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1},
+    {37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39},
+    {35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37},
+    {33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35},
+    {31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33},
+    {29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31},
+    {27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29},
+    {25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27},
+    {23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25},
+    {22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23},
+    {24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22},
+    {26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24},
+    {28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26},
+    {30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28},
+    {32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30},
+    {34,36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32},
+    {36,38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34},
+    {38,0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36},
+    {0,2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38},
+    {2,4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0},
+    {4,6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2},
+    {6,8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4},
+    {8,10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6},
+    {10,12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8},
+    {12,14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10},
+    {14,16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12},
+    {16,18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14},
+    {18,20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16},
+    {20,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,23,22,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18}
+   },
+   {
+    {22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21},
+    {20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22},
+    {18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20},
+    {16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18},
+    {14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16},
+    {12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14},
+    {10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12},
+    {8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10},
+    {6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8},
+    {4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6},
+    {2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4},
+    {0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2},
+    {38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0},
+    {36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38},
+    {34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36},
+    {32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34},
+    {30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32},
+    {28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30},
+    {26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28},
+    {24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26},
+    {23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24},
+    {25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23},
+    {27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25},
+    {29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27},
+    {31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29},
+    {33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31},
+    {35,37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33},
+    {37,39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35},
+    {39,1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37},
+    {1,3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39},
+    {3,5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1},
+    {5,7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3},
+    {7,9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5},
+    {9,11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7},
+    {11,13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9},
+    {13,15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11},
+    {15,17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13},
+    {17,19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15},
+    {19,21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17},
+    {21,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,24,23,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19}
+   },
+   {
+    {23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22},
+    {21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23},
+    {19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21},
+    {17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19},
+    {15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17},
+    {13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15},
+    {11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13},
+    {9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11},
+    {7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9},
+    {5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7},
+    {3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5},
+    {1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3},
+    {39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1},
+    {37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39},
+    {35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37},
+    {33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35},
+    {31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33},
+    {29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31},
+    {27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29},
+    {25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27},
+    {24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25},
+    {26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24},
+    {28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26},
+    {30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28},
+    {32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30},
+    {34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32},
+    {36,38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34},
+    {38,0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36},
+    {0,2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38},
+    {2,4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0},
+    {4,6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2},
+    {6,8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4},
+    {8,10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6},
+    {10,12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8},
+    {12,14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10},
+    {14,16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12},
+    {16,18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14},
+    {18,20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16},
+    {20,22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18},
+    {22,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,25,24,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20}
+   },
+   {
+    {24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23},
+    {22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24},
+    {20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22},
+    {18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20},
+    {16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18},
+    {14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16},
+    {12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14},
+    {10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12},
+    {8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10},
+    {6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8},
+    {4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6},
+    {2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4},
+    {0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2},
+    {38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0},
+    {36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38},
+    {34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36},
+    {32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34},
+    {30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32},
+    {28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30},
+    {26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28},
+    {25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26},
+    {27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25},
+    {29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27},
+    {31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29},
+    {33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31},
+    {35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33},
+    {37,39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35},
+    {39,1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37},
+    {1,3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39},
+    {3,5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1},
+    {5,7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3},
+    {7,9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5},
+    {9,11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7},
+    {11,13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9},
+    {13,15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11},
+    {15,17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13},
+    {17,19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15},
+    {19,21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17},
+    {21,23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19},
+    {23,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,26,25,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21}
+   },
+   {
+    {25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24},
+    {23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25},
+    {21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23},
+    {19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21},
+    {17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19},
+    {15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17},
+    {13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15},
+    {11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13},
+    {9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11},
+    {7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9},
+    {5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7},
+    {3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5},
+    {1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3},
+    {39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1},
+    {37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39},
+    {35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37},
+    {33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35},
+    {31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33},
+    {29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31},
+    {27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29},
+    {26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27},
+    {28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26},
+    {30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28},
+    {32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30},
+    {34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32},
+    {36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34},
+    {38,0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36},
+    {0,2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38},
+    {2,4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0},
+    {4,6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2},
+    {6,8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4},
+    {8,10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6},
+    {10,12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8},
+    {12,14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10},
+    {14,16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12},
+    {16,18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14},
+    {18,20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16},
+    {20,22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18},
+    {22,24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20},
+    {24,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,27,26,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22}
+   },
+   {
+    {26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25},
+    {24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26},
+    {22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24},
+    {20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22},
+    {18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20},
+    {16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18},
+    {14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16},
+    {12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14},
+    {10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12},
+    {8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10},
+    {6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8},
+    {4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6},
+    {2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4},
+    {0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2},
+    {38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0},
+    {36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38},
+    {34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36},
+    {32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34},
+    {30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32},
+    {28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30},
+    {27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28},
+    {29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27},
+    {31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29},
+    {33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31},
+    {35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33},
+    {37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35},
+    {39,1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37},
+    {1,3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39},
+    {3,5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1},
+    {5,7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3},
+    {7,9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5},
+    {9,11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7},
+    {11,13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9},
+    {13,15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11},
+    {15,17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13},
+    {17,19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15},
+    {19,21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17},
+    {21,23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19},
+    {23,25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21},
+    {25,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,28,27,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23}
+   },
+   {
+    {27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26},
+    {25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27},
+    {23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25},
+    {21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23},
+    {19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21},
+    {17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19},
+    {15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17},
+    {13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15},
+    {11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13},
+    {9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11},
+    {7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9},
+    {5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7},
+    {3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5},
+    {1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3},
+    {39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1},
+    {37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39},
+    {35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37},
+    {33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35},
+    {31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33},
+    {29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31},
+    {28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29},
+    {30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28},
+    {32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30},
+    {34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32},
+    {36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34},
+    {38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36},
+    {0,2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38},
+    {2,4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0},
+    {4,6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2},
+    {6,8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4},
+    {8,10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6},
+    {10,12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8},
+    {12,14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10},
+    {14,16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12},
+    {16,18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14},
+    {18,20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16},
+    {20,22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18},
+    {22,24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20},
+    {24,26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22},
+    {26,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,29,28,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24}
+   },
+   {
+    {28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27},
+    {26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28},
+    {24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26},
+    {22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24},
+    {20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22},
+    {18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20},
+    {16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18},
+    {14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16},
+    {12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14},
+    {10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12},
+    {8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10},
+    {6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8},
+    {4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6},
+    {2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4},
+    {0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2},
+    {38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0},
+    {36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38},
+    {34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36},
+    {32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34},
+    {30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32},
+    {29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30},
+    {31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29},
+    {33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31},
+    {35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33},
+    {37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35},
+    {39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37},
+    {1,3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39},
+    {3,5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1},
+    {5,7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3},
+    {7,9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5},
+    {9,11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7},
+    {11,13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9},
+    {13,15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11},
+    {15,17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13},
+    {17,19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15},
+    {19,21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17},
+    {21,23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19},
+    {23,25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21},
+    {25,27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23},
+    {27,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,30,29,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25}
+   },
+   {
+    {29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28},
+    {27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29},
+    {25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27},
+    {23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25},
+    {21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23},
+    {19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21},
+    {17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19},
+    {15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17},
+    {13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15},
+    {11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13},
+    {9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11},
+    {7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9},
+    {5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7},
+    {3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5},
+    {1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3},
+    {39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1},
+    {37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39},
+    {35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37},
+    {33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35},
+    {31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33},
+    {30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31},
+    {32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30},
+    {34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32},
+    {36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34},
+    {38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36},
+    {0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38},
+    {2,4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0},
+    {4,6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2},
+    {6,8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4},
+    {8,10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6},
+    {10,12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8},
+    {12,14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10},
+    {14,16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12},
+    {16,18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14},
+    {18,20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16},
+    {20,22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18},
+    {22,24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20},
+    {24,26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22},
+    {26,28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24},
+    {28,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,31,30,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26}
+   },
+   {
+    {30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29},
+    {28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30},
+    {26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28},
+    {24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26},
+    {22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24},
+    {20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22},
+    {18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20},
+    {16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18},
+    {14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16},
+    {12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14},
+    {10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12},
+    {8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10},
+    {6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8},
+    {4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6},
+    {2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4},
+    {0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2},
+    {38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0},
+    {36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38},
+    {34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36},
+    {32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34},
+    {31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32},
+    {33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31},
+    {35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33},
+    {37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35},
+    {39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37},
+    {1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39},
+    {3,5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1},
+    {5,7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3},
+    {7,9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5},
+    {9,11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7},
+    {11,13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9},
+    {13,15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11},
+    {15,17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13},
+    {17,19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15},
+    {19,21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17},
+    {21,23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19},
+    {23,25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21},
+    {25,27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23},
+    {27,29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25},
+    {29,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,32,31,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27}
+   },
+   {
+    {31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30},
+    {29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31},
+    {27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29},
+    {25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27},
+    {23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25},
+    {21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23},
+    {19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21},
+    {17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19},
+    {15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17},
+    {13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15},
+    {11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13},
+    {9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11},
+    {7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9},
+    {5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7},
+    {3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5},
+    {1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3},
+    {39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1},
+    {37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39},
+    {35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37},
+    {33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35},
+    {32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33},
+    {34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32},
+    {36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34},
+    {38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36},
+    {0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38},
+    {2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0},
+    {4,6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2},
+    {6,8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4},
+    {8,10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6},
+    {10,12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8},
+    {12,14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10},
+    {14,16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12},
+    {16,18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14},
+    {18,20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16},
+    {20,22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18},
+    {22,24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20},
+    {24,26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22},
+    {26,28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24},
+    {28,30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26},
+    {30,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,33,32,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28}
+   },
+   {
+    {32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31},
+    {30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32},
+    {28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30},
+    {26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28},
+    {24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26},
+    {22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24},
+    {20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22},
+    {18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20},
+    {16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18},
+    {14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16},
+    {12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14},
+    {10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12},
+    {8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10},
+    {6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8},
+    {4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6},
+    {2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4},
+    {0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2},
+    {38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0},
+    {36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38},
+    {34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36},
+    {33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34},
+    {35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33},
+    {37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35},
+    {39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37},
+    {1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39},
+    {3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1},
+    {5,7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3},
+    {7,9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5},
+    {9,11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7},
+    {11,13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9},
+    {13,15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11},
+    {15,17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13},
+    {17,19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15},
+    {19,21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17},
+    {21,23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19},
+    {23,25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21},
+    {25,27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23},
+    {27,29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25},
+    {29,31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27},
+    {31,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,34,33,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29}
+   },
+   {
+    {33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32},
+    {31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33},
+    {29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31},
+    {27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29},
+    {25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27},
+    {23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25},
+    {21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23},
+    {19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21},
+    {17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19},
+    {15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17},
+    {13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15},
+    {11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13},
+    {9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11},
+    {7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9},
+    {5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7},
+    {3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5},
+    {1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3},
+    {39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1},
+    {37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39},
+    {35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37},
+    {34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35},
+    {36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34},
+    {38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36},
+    {0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38},
+    {2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0},
+    {4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2},
+    {6,8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4},
+    {8,10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6},
+    {10,12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8},
+    {12,14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10},
+    {14,16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12},
+    {16,18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14},
+    {18,20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16},
+    {20,22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18},
+    {22,24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20},
+    {24,26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22},
+    {26,28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24},
+    {28,30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26},
+    {30,32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28},
+    {32,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,35,34,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30}
+   },
+   {
+    {34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33},
+    {32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34},
+    {30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32},
+    {28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30},
+    {26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28},
+    {24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26},
+    {22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24},
+    {20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22},
+    {18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20},
+    {16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18},
+    {14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16},
+    {12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14},
+    {10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12},
+    {8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10},
+    {6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8},
+    {4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6},
+    {2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4},
+    {0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2},
+    {38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0},
+    {36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38},
+    {35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36},
+    {37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35},
+    {39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37},
+    {1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39},
+    {3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1},
+    {5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3},
+    {7,9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5},
+    {9,11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7},
+    {11,13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9},
+    {13,15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11},
+    {15,17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13},
+    {17,19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15},
+    {19,21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17},
+    {21,23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19},
+    {23,25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21},
+    {25,27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23},
+    {27,29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25},
+    {29,31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27},
+    {31,33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29},
+    {33,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,36,35,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31}
+   },
+   {
+    {35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34},
+    {33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35},
+    {31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33},
+    {29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31},
+    {27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29},
+    {25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27},
+    {23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25},
+    {21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23},
+    {19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21},
+    {17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19},
+    {15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17},
+    {13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15},
+    {11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13},
+    {9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11},
+    {7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9},
+    {5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7},
+    {3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5},
+    {1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3},
+    {39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1},
+    {37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39},
+    {36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37},
+    {38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36},
+    {0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38},
+    {2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0},
+    {4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2},
+    {6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4},
+    {8,10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6},
+    {10,12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8},
+    {12,14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10},
+    {14,16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12},
+    {16,18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14},
+    {18,20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16},
+    {20,22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18},
+    {22,24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20},
+    {24,26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22},
+    {26,28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24},
+    {28,30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26},
+    {30,32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28},
+    {32,34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30},
+    {34,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,37,36,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32}
+   },
+   {
+    {36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35},
+    {34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36},
+    {32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34},
+    {30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32},
+    {28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30},
+    {26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28},
+    {24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26},
+    {22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24},
+    {20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22},
+    {18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20},
+    {16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18},
+    {14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16},
+    {12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14},
+    {10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12},
+    {8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10},
+    {6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8},
+    {4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6},
+    {2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4},
+    {0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2},
+    {38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0},
+    {37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38},
+    {39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37},
+    {1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39},
+    {3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1},
+    {5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3},
+    {7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5},
+    {9,11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7},
+    {11,13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9},
+    {13,15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11},
+    {15,17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13},
+    {17,19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15},
+    {19,21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17},
+    {21,23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19},
+    {23,25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21},
+    {25,27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23},
+    {27,29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25},
+    {29,31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27},
+    {31,33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29},
+    {33,35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31},
+    {35,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,38,37,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33}
+   },
+   {
+    {37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36},
+    {35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37},
+    {33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35},
+    {31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33},
+    {29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31},
+    {27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29},
+    {25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27},
+    {23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25},
+    {21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23},
+    {19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21},
+    {17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19},
+    {15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17},
+    {13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15},
+    {11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13},
+    {9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11},
+    {7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9},
+    {5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7},
+    {3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5},
+    {1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3},
+    {39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1},
+    {38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39},
+    {0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38},
+    {2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0},
+    {4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2},
+    {6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4},
+    {8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6},
+    {10,12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8},
+    {12,14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10},
+    {14,16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12},
+    {16,18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14},
+    {18,20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16},
+    {20,22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18},
+    {22,24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20},
+    {24,26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22},
+    {26,28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24},
+    {28,30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26},
+    {30,32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28},
+    {32,34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30},
+    {34,36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32},
+    {36,37,35,33,31,29,27,25,23,21,19,17,15,13,11,9,7,5,3,1,39,38,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34}
+   },
+   {
+    {38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37},
+    {36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38},
+    {34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36},
+    {32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34},
+    {30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32},
+    {28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30},
+    {26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28},
+    {24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26},
+    {22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24},
+    {20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22},
+    {18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20},
+    {16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18},
+    {14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16},
+    {12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14},
+    {10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12},
+    {8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10},
+    {6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8},
+    {4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6},
+    {2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4},
+    {0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2},
+    {39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0},
+    {1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39},
+    {3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1},
+    {5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3},
+    {7,9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5},
+    {9,11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7},
+    {11,13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9},
+    {13,15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11},
+    {15,17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13},
+    {17,19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15},
+    {19,21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17},
+    {21,23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19},
+    {23,25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21},
+    {25,27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23},
+    {27,29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25},
+    {29,31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27},
+    {31,33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29},
+    {33,35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31},
+    {35,37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33},
+    {37,38,36,34,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2,0,39,1,3,5,7,9,11,13,15,17,19,21,23,25,27,29,31,33,35}
+   }
+  };
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+#if defined(__cpp_lib_span)
+#include <span>
+#endif
+
+#include "spider_cipher_core.h"
+
+namespace spider {
+
+  //
+  // C++17 face of Spider Cipher Core.
+  //
+  // spider::Deck is a value type over SpiderCipherDeck whose init,
+  // cut, shuffle and step are constexpr, so decks (and short
+  // packets) can be worked out at compile time.  The per-card step
+  // is templated on the Mode, so the loop in spider_cipher_core.h
+  // has no scrambling/unscrambling branch.
+  //
+  // spider::Scrambler scrambler(key);   { key is 40 cards }
+  // if (!scrambler) { bad key }
+  // scrambler(packet);                  { in place, or (in,out) }
+  //
+  // Sessions run the C core (whatever engine is selected), so the
+  // output is the C core's byte for byte.  They are move only and
+  // wipe their deck when destroyed or moved from.
+  //
+
+  constexpr std::size_t CARDS = SPIDER_CIPHER_CARDS;
+
+  using Card = SpiderCipherCard;
+
+  enum class Mode { Scramble, Unscramble };
+
+#if defined(__cpp_lib_span)
+  template <typename T>
+  using span = std::span<T>;
+#else
+  // the part of std::span the packet API needs.
+  template <typename T>
+  class span {
+  public:
+    constexpr span() noexcept : data_(nullptr), size_(0) {}
+    constexpr span(T *data, std::size_t size) noexcept : data_(data), size_(size) {}
+    template <std::size_t N>
+    constexpr span(T (&array)[N]) noexcept : data_(array), size_(N) {}
+    template <typename C,
+	      typename = std::enable_if_t<
+		std::is_convertible_v<decltype(std::declval<C&>().data()), T*>>>
+    constexpr span(C &&container) noexcept
+      : data_(container.data()), size_(container.size()) {}
+
+    constexpr T *data() const noexcept { return data_; }
+    constexpr std::size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+    constexpr T &operator[](std::size_t i) const noexcept { return data_[i]; }
+    constexpr T *begin() const noexcept { return data_; }
+    constexpr T *end() const noexcept { return data_+size_; }
+
+  private:
+    T *data_;
+    std::size_t size_;
+  };
+#endif
+
+  //
+  // The same deck as SpiderCipherDeck (cards and their ats), with
+  // the same steps as spider_cipher_core.c in constexpr scalar
+  // code.
+  //
+  class Deck {
+  public:
+    // The tag card is TAG_ADD past the card at TAG_ZTH, the cut card
+    // is the clear card plus the card at CUT_ZTH (the core's private
+    // SPIDER_CIPHER_TAG_ZTH, _TAG_ADD and _CUT_ZTH).
+    static constexpr std::size_t TAG_ZTH = 2;
+    static constexpr std::size_t TAG_ADD = 39;
+    static constexpr std::size_t CUT_ZTH = 0;
+
+    // 0,...,39
+    constexpr Deck() noexcept : deck_{} { init(); }
+
+    constexpr explicit Deck(const SpiderCipherDeck &deck) noexcept : deck_(deck) {}
+
+    // 0,...,39 (also the wipe).
+    constexpr void init() noexcept {
+      for (std::size_t i=0; i<CARDS; ++i) {
+	deck_.cards[i]=Card(i);
+	deck_.ats[i]=uint8_t(i);
+      }
+    }
+
+    // key[0],...,key[39], as SpiderCipherDeckInitFromArray.
+    //
+    // RETURN VALUE
+    //  true - deck was set.
+    //  false - key is not 40 cards of 0..39 without repeats (deck is
+    //          wiped).
+    //
+    constexpr bool init(span<const Card> key) noexcept {
+      uint64_t seen = 0;
+      if (key.size() != CARDS) {
+	init();
+	return false;
+      }
+      for (std::size_t i=0; i<CARDS; ++i) {
+	Card card = key[i];
+	seen |= uint64_t(card < 64) << (card & 63);
+	deck_.cards[i]=card;
+      }
+      if (seen != (uint64_t(1) << CARDS)-1) {
+	init();
+	return false;
+      }
+      for (std::size_t i=0; i<CARDS; ++i) {
+	deck_.ats[key[i]]=uint8_t(i);
+      }
+      return true;
+    }
+
+    constexpr Card card(std::size_t at) const noexcept { return deck_.cards[at]; }
+    constexpr uint8_t at(Card card) const noexcept { return deck_.ats[card]; }
+
+    constexpr Card tag() const noexcept {
+      return Card((deck_.cards[TAG_ZTH]+TAG_ADD) % CARDS);
+    }
+
+    constexpr Card noise() const noexcept {
+      return deck_.cards[(deck_.ats[tag()]+1) % CARDS];
+    }
+
+    constexpr Card cutCard(Card clear) const noexcept {
+      return Card((clear+deck_.cards[CUT_ZTH]) % CARDS);
+    }
+
+    // cut so card is on top.
+    constexpr Deck cut(Card card) const noexcept {
+      Deck out;
+      std::size_t cutAt = deck_.ats[card % CARDS];
+      std::size_t uncutAt = (CARDS-cutAt) % CARDS;
+      for (std::size_t i=0; i<CARDS; ++i) {
+	out.deck_.cards[i]=deck_.cards[(i+cutAt) % CARDS];
+	out.deck_.ats[i]=uint8_t((deck_.ats[i]+uncutAt) % CARDS);
+      }
+      return out;
+    }
+
+    // even cards to the back, odd cards to the front.
+    constexpr Deck backFrontShuffle() const noexcept {
+      Deck out;
+      for (std::size_t i=0; i<CARDS/2; ++i) {
+	out.deck_.cards[CARDS/2+i]=deck_.cards[2*i];
+	out.deck_.cards[CARDS/2-(i+1)]=deck_.cards[2*i+1];
+      }
+      for (std::size_t i=0; i<CARDS; ++i) {
+	std::size_t was = deck_.ats[i];
+	out.deck_.ats[i]=uint8_t(was & 1 ? CARDS/2-1-was/2 : CARDS/2+was/2);
+      }
+      return out;
+    }
+
+    // cut at the tag, shuffle, cut at the cut card.
+    constexpr void advance(Card clear) noexcept {
+      Card cutTo = cutCard(clear);
+      *this = cut(tag()).backFrontShuffle().cut(cutTo);
+    }
+
+    // scramble (or unscramble) one card and advance.
+    template <Mode mode>
+    constexpr Card step(Card in) noexcept {
+      Card clear = 0, out = 0;
+      if constexpr (mode == Mode::Scramble) {
+	clear = in;
+	out = Card((clear+noise()) % CARDS);
+      } else {
+	out = clear = Card((in+CARDS-noise()) % CARDS);
+      }
+      advance(clear);
+      return out;
+    }
+
+    // step over in into out (out.size() >= in.size(), in == out is
+    // fine).
+    template <Mode mode>
+    constexpr void steps(span<const Card> in, span<Card> out) noexcept {
+      for (std::size_t i=0; i<in.size(); ++i) {
+	out[i]=step<mode>(in[i]);
+      }
+    }
+
+    constexpr const SpiderCipherDeck &c() const noexcept { return deck_; }
+    constexpr SpiderCipherDeck &c() noexcept { return deck_; }
+
+    friend constexpr bool operator==(const Deck &a, const Deck &b) noexcept {
+      for (std::size_t i=0; i<CARDS; ++i) {
+	if (a.deck_.cards[i] != b.deck_.cards[i]) return false;
+	if (a.deck_.ats[i] != b.deck_.ats[i]) return false;
+      }
+      return true;
+    }
+
+    friend constexpr bool operator!=(const Deck &a, const Deck &b) noexcept {
+      return !(a == b);
+    }
+
+  private:
+    SpiderCipherDeck deck_;
+  };
+
+  //
+  // A keyed deck that scrambles (or unscrambles) packets with the
+  // C core.  Move only: the deck is never copied, and is wiped when
+  // the session is destroyed or moved from.
+  //
+  template <Mode mode>
+  class Session {
+  public:
+    // false (and a wiped deck) if key is not a permutation of 0..39.
+    explicit Session(span<const Card> key) noexcept : ok_(deck_.init(key)) {}
+
+    Session(const Session &) = delete;
+    Session &operator=(const Session &) = delete;
+
+    Session(Session &&other) noexcept : deck_(other.deck_), ok_(other.ok_) {
+      other.wipe();
+    }
+
+    Session &operator=(Session &&other) noexcept {
+      if (this != &other) {
+	deck_ = other.deck_;
+	ok_ = other.ok_;
+	other.wipe();
+      }
+      return *this;
+    }
+
+    ~Session() { wipe(); }
+
+    bool ok() const noexcept { return ok_; }
+    explicit operator bool() const noexcept { return ok_; }
+
+    // in into out, continuing from the previous packet.
+    //
+    // RETURN VALUE
+    //  cards done: in.size(), or 0 if the key was bad or out is
+    //  shorter than in.
+    //
+    std::size_t operator()(span<const Card> in, span<Card> out) noexcept {
+      if (!ok_ || out.size() < in.size()) return 0;
+      if constexpr (mode == Mode::Scramble) {
+	SpiderCipherScrambleBuffer(&deck_.c(),in.data(),out.data(),in.size());
+      } else {
+	SpiderCipherUnscrambleBuffer(&deck_.c(),in.data(),out.data(),in.size());
+      }
+      return in.size();
+    }
+
+    // in place.
+    std::size_t operator()(span<Card> packet) noexcept {
+      return (*this)(span<const Card>(packet),packet);
+    }
+
+    const Deck &deck() const noexcept { return deck_; }
+
+  private:
+    // SpiderCipherDeckInit is an out of line call, so the wipe is
+    // not dropped as a dead store.
+    void wipe() noexcept {
+      SpiderCipherDeckInit(&deck_.c());
+      ok_ = false;
+    }
+
+    Deck deck_;
+    bool ok_;
+  };
+
+  using Scrambler = Session<Mode::Scramble>;
+  using Unscrambler = Session<Mode::Unscramble>;
+
+} // namespace spider
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "spider_cipher_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  //
+  // Spider Cipher Deck Batch runs up to 32 independent decks
+  // (lanes) in lock step, one card per lane per step.
+  //
+  // The batch is kept in structure of arrays form: ats[card][lane]
+  // is where card is in lane's deck, so the position of a card
+  // in every deck is contiguous.  With only the ats every step is
+  // the same compare/select arithmetic in every lane (no gathers),
+  // one 32 byte row at a time with AVX2.
+  //
+  // The AVX2 step always works all 32 lanes of every row: with 8 or
+  // 16 lanes the unused lanes are scratch work (advanced on card 0
+  // and never read), so a step costs the same for any lane count.
+  //
+  // The batch only pays off with the AVX2 engine.  On other engines
+  // the buffer functions run each lane through SpiderCipherScrambleBuffer
+  // (or Unscramble) in turn, and the single step functions fall back
+  // to a scalar loop over the lanes that is slower than per deck.
+  //
+  // SpiderCipherDeckBatch batch;
+  // SpiderCipherDeckBatchInit(&batch,16);
+  // for (int lane=0; lane<16; ++lane) {
+  //    SpiderCipherDeckInitBy(&deck,key[lane],NULL);
+  //    SpiderCipherDeckBatchSet(&batch,lane,&deck);
+  // }
+  // SpiderCipherBatchScrambleBuffer(&batch,packets,packets,packetSize);
+  // SpiderCipherDeckBatchInit(&batch,16);
+  //
+
+#define SPIDER_CIPHER_BATCH_LANES 32
+
+  typedef struct {
+    uint8_t lanes;
+    uint8_t ats[SPIDER_CIPHER_CARDS][SPIDER_CIPHER_BATCH_LANES];
+  } SpiderCipherDeckBatch;
+
+  // Initialize every lane to 0,...,39
+  //
+  // RETURN VALUE
+  //  1 - batch was initialized.
+  //  0 - lanes is not 8, 16 or 32.
+  //
+  int SpiderCipherDeckBatchInit(SpiderCipherDeckBatch *batch, int lanes);
+
+  // Copy deck into lane of batch.
+  void SpiderCipherDeckBatchSet(SpiderCipherDeckBatch *batch,
+				int lane,
+				SpiderCipherDeck *deck);
+
+  // Copy lane of batch into deck.
+  void SpiderCipherDeckBatchGet(SpiderCipherDeckBatch *batch,
+				int lane,
+				SpiderCipherDeck *deck);
+
+  // scrambled[lane] = (clear[lane] + noise[lane]) mod 40
+  void SpiderCipherBatchScramble(SpiderCipherDeckBatch *batch,
+				 const SpiderCipherCard *clear,
+				 SpiderCipherCard *scrambled);
+
+  // clear[lane] = (scrambled[lane] - noise[lane]) mod 40
+  void SpiderCipherBatchUnscramble(SpiderCipherDeckBatch *batch,
+				   const SpiderCipherCard *scrambled,
+				   SpiderCipherCard *clear);
+
+  // Advance every lane by its clear[lane] card (in place).
+  void SpiderCipherBatchAdvanceDeck(SpiderCipherDeckBatch *batch,
+				    const SpiderCipherCard *clear);
+
+  // Scramble n cards of every lane's packet in[lane] into
+  // out[lane].  in[lane] == out[lane] (in place) is fine.
+  void SpiderCipherBatchScrambleBuffer(SpiderCipherDeckBatch *batch,
+				       const SpiderCipherCard *const *in,
+				       SpiderCipherCard *const *out,
+				       size_t n);
+
+  // Unscramble n cards of every lane's packet in[lane] into
+  // out[lane].
+  void SpiderCipherBatchUnscrambleBuffer(SpiderCipherDeckBatch *batch,
+					 const SpiderCipherCard *const *in,
+					 SpiderCipherCard *const *out,
+					 size_t n);
+
+#ifdef __cplusplus
+}
+#endif
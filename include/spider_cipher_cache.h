@@ -0,0 +1,78 @@
+#pragma once
+
+#include "spider_cipher_core.h"
+
+#ifdef __cplusplus
+#define SPIDER_CIPHER_CACHE_ALIGN alignas(64)
+extern "C" {
+#else
+#define SPIDER_CIPHER_CACHE_ALIGN _Alignas(64)
+#endif
+
+  //
+  // Spider Cipher Deck Cache keeps validated decks by key, so
+  // packets sharing a key skip SpiderCipherDeckInitBy.
+  //
+  // The key cards (what SpiderCipherDeckInitBy would get from f)
+  // are the fingerprint.  A hit is a copy of the cached deck, a
+  // miss validates the key with SpiderCipherDeckInitFromArray and
+  // caches the deck.
+  //
+  // The table is open addressing over a fixed number of slots: a
+  // key lives in one of the WAYS slots after its hash.  When those
+  // are full, CLOCK (second chance) picks the slot to evict, and the
+  // evicted deck is wiped before reuse.
+  //
+  // SpiderCipherDeckCache cache;   { ~33K, better static than stack }
+  // SpiderCipherDeckCacheInit(&cache);
+  // for (each packet) {
+  //    if (!SpiderCipherDeckCacheGet(&cache,packetKey,&deck)) { bad key }
+  //    SpiderCipherScrambleBuffer(&deck,packet,packet,packetSize);
+  // }
+  // SpiderCipherDeckCacheInit(&cache);
+  //
+  // A cache is not shared between threads; give each its own.
+  //
+
+#define SPIDER_CIPHER_DECK_CACHE_SLOTS 256
+#define SPIDER_CIPHER_DECK_CACHE_WAYS    8
+
+  // one deck per pair of cache lines.
+  typedef struct {
+    SPIDER_CIPHER_CACHE_ALIGN SpiderCipherDeck deck;
+  } SpiderCipherDeckCacheEntry;
+
+  typedef struct {
+    SpiderCipherDeckCacheEntry entries[SPIDER_CIPHER_DECK_CACHE_SLOTS];
+    // 0 - empty slot, else hash of the key (never 0).
+    uint32_t hashes[SPIDER_CIPHER_DECK_CACHE_SLOTS];
+    uint8_t referenced[SPIDER_CIPHER_DECK_CACHE_SLOTS];
+    uint8_t hand;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+  } SpiderCipherDeckCache;
+
+  // Wipe every cached deck, empty the cache and zero the counters.
+  void SpiderCipherDeckCacheInit(SpiderCipherDeckCache *cache);
+
+  // Set deck from the 40 key cards, cached or validated.
+  //
+  // RETURN VALUE
+  //  1 - deck was set.
+  //  0 - key is not a permutation of 0..39 (nothing is cached).
+  //
+  int SpiderCipherDeckCacheGet(SpiderCipherDeckCache *cache,
+			       const SpiderCipherCard *key,
+			       SpiderCipherDeck *deck);
+
+  // SpiderCipherDeckCacheGet of the key f(0,misc),...,f(39,misc),
+  // a drop in for SpiderCipherDeckInitBy.
+  int SpiderCipherDeckCacheGetBy(SpiderCipherDeckCache *cache,
+				 SpiderCipherCard (*f)(uint8_t at, void *misc),
+				 void *misc,
+				 SpiderCipherDeck *deck);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -42,6 +43,17 @@ extern "C" {
   // SpiderCiperDeckInit(&deck);
   // SpiderCiperDeckInit(&spare);  
   //
+  // or, for a whole packet at once,
+  //
+  // SpiderCipherDeck deck;
+  // SpiderCipherDeckInitBy(&deck,key,NULL);
+  // if (scrambling) {
+  //    SpiderCipherScrambleBuffer(&deck,packet,packet,packetSize);
+  // } else if (unscrambling) {
+  //    SpiderCipherUnscrambleBuffer(&deck,packet,packet,packetSize);
+  // }
+  // SpiderCiperDeckInit(&deck);
+  //
 
   //
   // A SpiderCipherCard is in the range 0...39
@@ -75,6 +87,15 @@ extern "C" {
 			     SpiderCipherCard (*f)(uint8_t at, void *misc),
 			     void *misc);
 
+  // Initialize deck to key[0],...,key[39] without a callback.
+  //
+  // RETURN VALUE
+  //  1 - Deck was properly initialized.
+  //  0 - key is out of 0..39 or repeats a value (deck is wiped).
+  //
+  int SpiderCipherDeckInitFromArray(SpiderCipherDeck *deck,
+				    const SpiderCipherCard key[SPIDER_CIPHER_CARDS]);
+
   // scrambled = (clear + noise) mod 40
   SpiderCipherCard SpiderCipherScramble(SpiderCipherDeck *deck,
 					SpiderCipherCard  clear);
@@ -89,6 +110,141 @@ extern "C" {
 			       SpiderCipherCard clear,
 			       SpiderCipherDeck *spare);
 
+  // Scramble n clear cards in[0..n-1] into out[0..n-1], advancing
+  // the deck after each card.  Same result as the per-card loop,
+  // but the deck and spare are private copies for the whole run.
+  // in == out (in place) is fine; other overlaps are not.
+  void SpiderCipherScrambleBuffer(SpiderCipherDeck *deck,
+				  const SpiderCipherCard *in,
+				  SpiderCipherCard *out,
+				  size_t n);
+
+  // Unscramble n scrambled cards in[0..n-1] into out[0..n-1].
+  // Same in place rules as SpiderCipherScrambleBuffer.
+  void SpiderCipherUnscrambleBuffer(SpiderCipherDeck *deck,
+				    const SpiderCipherCard *in,
+				    SpiderCipherCard *out,
+				    size_t n);
+
+  //
+  // A SpiderCipherLazyDeck is the same cipher with only the cards,
+  // no ats.  Positions are found by searching the 40 cards (one
+  // SIMD compare on SSE4.1/AVX2 engines), so each advance moves
+  // half the bytes of a SpiderCipherDeck.
+  //
+  // SpiderCipherDeck deck;
+  // SpiderCipherLazyDeck lazy;
+  // SpiderCipherDeckInitBy(&deck,key,NULL);
+  // SpiderCipherLazyDeckFrom(&lazy,&deck);
+  // SpiderCipherLazyScrambleBuffer(&lazy,packet,packet,packetSize);
+  // SpiderCipherLazyDeckInit(&lazy);
+  // SpiderCipherDeckInit(&deck);
+  //
+  typedef struct {
+    SpiderCipherCard cards[SPIDER_CIPHER_CARDS];
+  } SpiderCipherLazyDeck;
+
+  // Initialize lazy deck to 0,...,39
+  void SpiderCipherLazyDeckInit(SpiderCipherLazyDeck *lazy);
+
+  // Lazy deck with the same cards as deck.
+  void SpiderCipherLazyDeckFrom(SpiderCipherLazyDeck *lazy,
+				SpiderCipherDeck *deck);
+
+  // Deck with the same cards as lazy deck.
+  void SpiderCipherDeckFromLazy(SpiderCipherDeck *deck,
+				SpiderCipherLazyDeck *lazy);
+
+  SpiderCipherCard SpiderCipherLazyScramble(SpiderCipherLazyDeck *deck,
+					    SpiderCipherCard clear);
+
+  SpiderCipherCard SpiderCipherLazyUnscramble(SpiderCipherLazyDeck *deck,
+					      SpiderCipherCard scrambled);
+
+  void SpiderCipherLazyAdvanceDeck(SpiderCipherLazyDeck *deck,
+				   SpiderCipherCard clear,
+				   SpiderCipherLazyDeck *spare);
+
+  void SpiderCipherLazyScrambleBuffer(SpiderCipherLazyDeck *deck,
+				      const SpiderCipherCard *in,
+				      SpiderCipherCard *out,
+				      size_t n);
+
+  void SpiderCipherLazyUnscrambleBuffer(SpiderCipherLazyDeck *deck,
+					const SpiderCipherCard *in,
+					SpiderCipherCard *out,
+					size_t n);
+
+  //
+  // A SpiderCipherRotatedDeck is the same cipher with the deck's
+  // rotation kept as an offset: the logical top card is
+  // deck.cards[offset].  Cuts only change the offset, and only the
+  // back-front shuffle rewrites the cards (reading from the offset).
+  // It has its own entry points rather than an offset inside
+  // SpiderCipherDeck, whose cards and ats callers read directly.
+  //
+  typedef struct {
+    SpiderCipherDeck deck;
+    uint8_t offset;
+  } SpiderCipherRotatedDeck;
+
+  // Initialize rotated deck to 0,...,39
+  void SpiderCipherRotatedDeckInit(SpiderCipherRotatedDeck *rotated);
+
+  // Rotated deck with the same cards as deck.
+  void SpiderCipherRotatedDeckFrom(SpiderCipherRotatedDeck *rotated,
+				   SpiderCipherDeck *deck);
+
+  // Deck with the same (logical) cards as rotated deck.
+  void SpiderCipherDeckFromRotated(SpiderCipherDeck *deck,
+				   SpiderCipherRotatedDeck *rotated);
+
+  SpiderCipherCard SpiderCipherRotatedScramble(SpiderCipherRotatedDeck *deck,
+					       SpiderCipherCard clear);
+
+  SpiderCipherCard SpiderCipherRotatedUnscramble(SpiderCipherRotatedDeck *deck,
+						 SpiderCipherCard scrambled);
+
+  void SpiderCipherRotatedAdvanceDeck(SpiderCipherRotatedDeck *deck,
+				      SpiderCipherCard clear,
+				      SpiderCipherRotatedDeck *spare);
+
+  void SpiderCipherRotatedScrambleBuffer(SpiderCipherRotatedDeck *deck,
+					 const SpiderCipherCard *in,
+					 SpiderCipherCard *out,
+					 size_t n);
+
+  void SpiderCipherRotatedUnscrambleBuffer(SpiderCipherRotatedDeck *deck,
+					   const SpiderCipherCard *in,
+					   SpiderCipherCard *out,
+					   size_t n);
+
+  //
+  // Deck permutation engines.
+  //
+  // Cuts and shuffles can run on scalar code (the reference) or on
+  // SSE4.1 or AVX2 byte shuffles, or gather through a precomputed
+  // 40x40x40 advance table (TABLE, only when selected).  Every
+  // engine gives identical decks.  By default (AUTO) the fastest
+  // shuffle engine the cpu supports is picked on first use.
+  //
+#define SPIDER_CIPHER_ENGINE_AUTO   0
+#define SPIDER_CIPHER_ENGINE_SCALAR 1
+#define SPIDER_CIPHER_ENGINE_SSE41  2
+#define SPIDER_CIPHER_ENGINE_AVX2   3
+#define SPIDER_CIPHER_ENGINE_TABLE  4
+
+  // Select the engine used by all decks.
+  //
+  // RETURN VALUE
+  //  1 - engine is now selected.
+  //  0 - engine is not available on this cpu or build (no change).
+  //
+  int SpiderCipherEngineSelect(int engine);
+
+  // Currently selected engine (never AUTO).
+  int SpiderCipherEngine(void);
+
 #ifdef __cplusplus
 }
 #endif
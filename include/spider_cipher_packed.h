@@ -0,0 +1,79 @@
+#pragma once
+
+#include "spider_cipher_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  //
+  // Spider Cipher Packed streams hold 6 bits per card, 4 cards in
+  // 3 bytes (a 40 card deck in 30 bytes), most significant bits
+  // first, as base64 does:
+  //
+  //   byte 0 = a<<2 | b>>4
+  //   byte 1 = (b&15)<<4 | c>>2
+  //   byte 2 = (c&3)<<6 | d
+  //
+  // A stream of n cards is SPIDER_CIPHER_PACKED_BYTES(n) bytes; the
+  // last 1..3 cards of a partial group take only the bytes they
+  // need (unused low bits are 0).  The count of cards is not in the
+  // stream.
+  //
+  // Pack and unpack run the base64 codec tricks (pmaddubsw/pmaddwd
+  // to pack, pshufb and multiplies to unpack) on SSSE3 or AVX2 when
+  // that deck engine is selected, else scalar code.
+  //
+  // SpiderCipherDeck deck;
+  // uint8_t packet[SPIDER_CIPHER_PACKED_BYTES(packetSize)];
+  // SpiderCipherDeckInitBy(&deck,key,NULL);
+  // SpiderCipherScramblePacked(&deck,packet,packet,packetSize);
+  // SpiderCipherDeckInit(&deck);
+  //
+
+#define SPIDER_CIPHER_PACKED_BYTES(n) (((n)*6+7)/8)
+
+  // Pack cards[0..n-1] (each 0..63, only the low 6 bits are kept).
+  //
+  // RETURN VALUE
+  //  bytes written, SPIDER_CIPHER_PACKED_BYTES(n).
+  //
+  size_t SpiderCipherPack(const SpiderCipherCard *cards,
+			  uint8_t *packed,
+			  size_t n);
+
+  // Unpack n cards.
+  //
+  // RETURN VALUE
+  //  1 - every card is 0..39.
+  //  0 - some card is 40..63 (all n are still unpacked).
+  //
+  int SpiderCipherUnpack(const uint8_t *packed,
+			 SpiderCipherCard *cards,
+			 size_t n);
+
+  // SpiderCipherScrambleBuffer of n packed cards, packed to packed,
+  // through an L1 sized buffer of cards (no separate conversion
+  // pass).  in == out (in place) is fine; other overlaps are not.
+  //
+  // RETURN VALUE
+  //  1 - every card is 0..39 and all n are done.
+  //  0 - some card is 40..63.  The 512 card chunk holding it and
+  //      those after are not done: out is not written and deck is
+  //      not advanced over them.
+  //
+  int SpiderCipherScramblePacked(SpiderCipherDeck *deck,
+				 const uint8_t *in,
+				 uint8_t *out,
+				 size_t n);
+
+  // SpiderCipherUnscrambleBuffer of n packed cards (same return
+  // value as SpiderCipherScramblePacked).
+  int SpiderCipherUnscramblePacked(SpiderCipherDeck *deck,
+				   const uint8_t *in,
+				   uint8_t *out,
+				   size_t n);
+
+#ifdef __cplusplus
+}
+#endif
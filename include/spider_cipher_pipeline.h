@@ -0,0 +1,89 @@
+#pragma once
+
+#include "spider_cipher_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  //
+  // Spider Cipher Pipeline scrambles (or unscrambles) independent
+  // packets on a pool of worker threads.
+  //
+  // Each job names its key (as for SpiderCipherDeckInitBy) and its
+  // packet.  A worker initializes the deck, runs the buffer call and
+  // wipes the deck, then puts the job on the completion queue.
+  // Submitted jobs are spread over per-worker queues; an idle worker
+  // steals from the others, so uneven packets still keep every
+  // thread busy.
+  //
+  // SpiderCipherPipeline *pipeline = SpiderCipherPipelineNew(0);
+  // SpiderCipherPipelineJob jobs[count];
+  // for (size_t i=0; i<count; ++i) {
+  //    jobs[i].key = key; jobs[i].misc = &keys[i];
+  //    jobs[i].in = jobs[i].out = packets[i]; jobs[i].n = packetSize;
+  //    jobs[i].unscramble = 0;
+  // }
+  // SpiderCipherPipelineSubmit(pipeline,jobs,count);
+  // SpiderCipherPipelineJob *done[16];
+  // size_t k;
+  // while ((k=SpiderCipherPipelineComplete(pipeline,done,16)) > 0) {
+  //    { done[0..k-1] are finished, check done[i]->ok }
+  // }
+  // SpiderCipherPipelineFree(pipeline);
+  //
+  // The jobs (and their keys and packets) belong to the caller and
+  // must stay put until they come back from
+  // SpiderCipherPipelineComplete.
+  //
+
+  typedef struct {
+    SpiderCipherCard (*key)(uint8_t at, void *misc);
+    void *misc;
+    const SpiderCipherCard *in;
+    SpiderCipherCard *out;
+    size_t n;
+    int unscramble;
+    // set by the worker: 0 if key is not a deck (out untouched).
+    int ok;
+  } SpiderCipherPipelineJob;
+
+  typedef struct SpiderCipherPipeline SpiderCipherPipeline;
+
+  // Start a pipeline with threads workers (0 - one per online cpu).
+  //
+  // RETURN VALUE
+  //  NULL - could not allocate or start the workers.
+  //
+  SpiderCipherPipeline *SpiderCipherPipelineNew(int threads);
+
+  // Number of worker threads.
+  int SpiderCipherPipelineThreads(SpiderCipherPipeline *pipeline);
+
+  // Queue count jobs.
+  //
+  // RETURN VALUE
+  //  1 - jobs were queued.
+  //  0 - could not allocate queue space (nothing was queued).
+  //
+  int SpiderCipherPipelineSubmit(SpiderCipherPipeline *pipeline,
+				 SpiderCipherPipelineJob *jobs,
+				 size_t count);
+
+  // Wait for at least one finished job and take up to max of them
+  // into done.
+  //
+  // RETURN VALUE
+  //  number of jobs in done, 0 only if no job is outstanding.
+  //
+  size_t SpiderCipherPipelineComplete(SpiderCipherPipeline *pipeline,
+				      SpiderCipherPipelineJob **done,
+				      size_t max);
+
+  // Finish every outstanding job, stop the workers and free pipeline.
+  // Finished jobs that were not taken are simply dropped.
+  void SpiderCipherPipelineFree(SpiderCipherPipeline *pipeline);
+
+#ifdef __cplusplus
+}
+#endif
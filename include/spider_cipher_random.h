@@ -0,0 +1,78 @@
+#pragma once
+
+#include "spider_cipher_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  //
+  // Spider Cipher Random makes fresh decks (keys).
+  //
+  // A pool deck is Fisher-Yates shuffled with unbiased (rejection
+  // sampled) picks, then 40 rounds each cut and back-front shuffle
+  // the pool at a random card and mix the deck by the pool's noise
+  // card, so the deck comes out random even if it went in known.
+  //
+  // Entropy comes in bulk: from getrandom() through a pool of
+  // SPIDER_CIPHER_ENTROPY_POOL bytes, or from a caller buffer (an
+  // HSM, a test vector), one byte per pick.
+  //
+  // SpiderCipherEntropy entropy;
+  // SpiderCipherDeck decks[1000];
+  // SpiderCipherEntropyInit(&entropy);
+  // for (int i=0; i<1000; ++i) SpiderCipherDeckInit(&decks[i]);
+  // if (SpiderCipherRandomizeDecks(decks,1000,&entropy) != 1000) { no entropy }
+  // SpiderCipherEntropyFinish(&entropy);
+  //
+
+#define SPIDER_CIPHER_ENTROPY_POOL 4096
+
+  typedef struct {
+    uint8_t pool[SPIDER_CIPHER_ENTROPY_POOL];
+    // pool[at..size-1] are unused.
+    size_t at;
+    size_t size;
+    // caller bytes, NULL - refill from getrandom().
+    const uint8_t *buffer;
+    size_t bufferSize;
+  } SpiderCipherEntropy;
+
+  // Entropy from getrandom() (filled on first use).
+  void SpiderCipherEntropyInit(SpiderCipherEntropy *entropy);
+
+  // Entropy from bytes[0..size-1] only (they are not copied, and
+  // are never used twice).
+  void SpiderCipherEntropyInitBuffer(SpiderCipherEntropy *entropy,
+				     const uint8_t *bytes,
+				     size_t size);
+
+  // Wipe the unused pool.
+  void SpiderCipherEntropyFinish(SpiderCipherEntropy *entropy);
+
+  // Randomize decks[0..count-1] (each mixed from what it holds).
+  //
+  // RETURN VALUE
+  //  decks randomized: count, or fewer when the entropy ran out
+  //  (the deck being made when it did is wiped).
+  //
+  size_t SpiderCipherRandomizeDecks(SpiderCipherDeck *decks,
+				    size_t count,
+				    SpiderCipherEntropy *entropy);
+
+  // Randomize deck with values 0..randMax from rand(misc), one at a
+  // time (combined as needed for unbiased picks).
+  //
+  // RETURN VALUE
+  //  1 - deck was randomized.
+  //  0 - randMax < 1 or rand gave a value out of 0..randMax (deck is
+  //      wiped).
+  //
+  int SpiderCipherRandomize(SpiderCipherDeck *deck,
+			    int64_t (*rand)(void *misc),
+			    void *misc,
+			    int64_t randMax);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "spider_cipher_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  //
+  // Spider Cipher Rank numbers the 40! card orders of a deck.
+  //
+  // The rank is the Lehmer code of the cards (digit i is how many
+  // of the cards after i are smaller, radix 40-i) as one integer, so
+  // ranks order decks the way their cards compare lexicographically.
+  // 40! < 2^160, and the rank is stored in SPIDER_CIPHER_RANK_BYTES
+  // big endian bytes: memcmp of ranks orders them as memcmp of the
+  // cards would, in half the space.
+  //
+  // Digits come from a bit mask of the cards left (a popcount each,
+  // linear time), and are combined radix products of up to 2^32 at
+  // a time, so ranking is 6 multiply-adds of 5 words (and unranking
+  // 6 divisions by constants).
+  //
+  // uint8_t rank[SPIDER_CIPHER_RANK_BYTES];
+  // SpiderCipherRank(&deck,rank);
+  // ...
+  // if (!SpiderCipherUnrank(&deck,rank)) { not a rank }
+  //
+
+#define SPIDER_CIPHER_RANK_BYTES 20
+
+  // The rank of deck's cards, 0 .. 40!-1.
+  void SpiderCipherRank(const SpiderCipherDeck *deck,
+			uint8_t rank[SPIDER_CIPHER_RANK_BYTES]);
+
+  // The deck of rank.
+  //
+  // RETURN VALUE
+  //  1 - deck is the deck of rank.
+  //  0 - rank is 40! or more (deck is wiped).
+  //
+  int SpiderCipherUnrank(SpiderCipherDeck *deck,
+			 const uint8_t rank[SPIDER_CIPHER_RANK_BYTES]);
+
+#ifdef __cplusplus
+}
+#endif
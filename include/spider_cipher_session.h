@@ -0,0 +1,137 @@
+#pragma once
+
+#include "spider_cipher_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  //
+  // Spider Cipher Session scrambles (or unscrambles) one message
+  // that arrives in chunks.
+  //
+  // The session holds the deck between chunks, so a message may be
+  // split anywhere: feeding it in any chunks gives the same cards as
+  // one SpiderCipherScrambleBuffer over the whole message.  Feed
+  // works from in to out directly (no copies, no allocation).
+  //
+  // SpiderCipherSession session;
+  // if (!SpiderCipherSessionInit(&session,key,0)) { bad key }
+  // while (chunk = read(socket)) {
+  //    SpiderCipherSessionFeed(&session,chunk,chunk,chunkSize);
+  //    write(chunk);
+  // }
+  // SpiderCipherSessionFinish(&session);
+  //
+  // With a checkpoint log, the session also keeps the deck every
+  // interval cards, so it can later seek to any card of the message
+  // by replaying at most interval-1 cards from the checkpoint before
+  // it (instead of every card from the key).
+  //
+  // SpiderCipherCheckpoint checkpoints[1024];
+  // SpiderCipherCheckpointLog log;
+  // SpiderCipherCheckpointLogInit(&log,checkpoints,1024,256);
+  // SpiderCipherSessionInit(&session,key,0);
+  // SpiderCipherSessionLog(&session,&log);
+  // { feed the message }
+  // SpiderCipherSeek(&session,offset,message);
+  // SpiderCipherSessionFeed(&session,message+offset,out,n);
+  //
+
+  // The cards of the deck before card index*interval (the ats are
+  // rebuilt on restore).
+  typedef struct {
+    SpiderCipherCard cards[SPIDER_CIPHER_CARDS];
+  } SpiderCipherCheckpoint;
+
+  //
+  // The log is caller storage for capacity checkpoints.  When it is
+  // full it drops every other checkpoint and doubles the interval,
+  // so a long message still fits (with longer replays).
+  //
+  typedef struct {
+    SpiderCipherCheckpoint *checkpoints;
+    size_t capacity;
+    size_t count;
+    uint64_t interval;
+  } SpiderCipherCheckpointLog;
+
+  typedef struct {
+    SpiderCipherDeck deck;
+    // cards fed since init.
+    uint64_t cards;
+    // the most cards ever fed (seeks stay within them).
+    uint64_t fed;
+    int unscramble;
+    int ok;
+    // NULL - no checkpoints.
+    SpiderCipherCheckpointLog *log;
+  } SpiderCipherSession;
+
+  // Empty log over checkpoints[0..capacity-1], a checkpoint every
+  // interval cards (0 is taken as 1).
+  void SpiderCipherCheckpointLogInit(SpiderCipherCheckpointLog *log,
+				     SpiderCipherCheckpoint *checkpoints,
+				     size_t capacity,
+				     uint64_t interval);
+
+  // Start a session on the 40 key cards, scrambling (unscramble=0)
+  // or unscrambling.
+  //
+  // RETURN VALUE
+  //  1 - session is ready.
+  //  0 - key is not a permutation of 0..39 (every feed is refused).
+  //
+  int SpiderCipherSessionInit(SpiderCipherSession *session,
+			      const SpiderCipherCard key[SPIDER_CIPHER_CARDS],
+			      int unscramble);
+
+  // SpiderCipherSessionInit of the key f(0,misc),...,f(39,misc).
+  int SpiderCipherSessionInitBy(SpiderCipherSession *session,
+				SpiderCipherCard (*f)(uint8_t at, void *misc),
+				void *misc,
+				int unscramble);
+
+  // Keep checkpoints of this session in log (emptied first).
+  //
+  // RETURN VALUE
+  //  1 - logging from card 0.
+  //  0 - bad key, cards were already fed or capacity is 0.
+  //
+  int SpiderCipherSessionLog(SpiderCipherSession *session,
+			     SpiderCipherCheckpointLog *log);
+
+  // The next n cards of the message, in[0..n-1] into out[0..n-1]
+  // (same in place rules as SpiderCipherScrambleBuffer).
+  //
+  // RETURN VALUE
+  //  n - cards done.
+  //  0 - the session key was bad (out untouched).
+  //
+  size_t SpiderCipherSessionFeed(SpiderCipherSession *session,
+				 const SpiderCipherCard *in,
+				 SpiderCipherCard *out,
+				 size_t n);
+
+  // Put the session where it was before card offset, from the
+  // checkpoint before offset and the fed cards since then:
+  // message[0..offset-1] are the cards as fed (clear when
+  // scrambling, scrambled when unscrambling), and only the last
+  // offset % interval of them are read.
+  //
+  // RETURN VALUE
+  //  1 - the next feed is card offset.
+  //  0 - no log, bad key, or offset is past the most cards ever
+  //      fed (session unchanged).
+  //
+  int SpiderCipherSeek(SpiderCipherSession *session,
+		       uint64_t offset,
+		       const SpiderCipherCard *message);
+
+  // End of message: wipe the session and its checkpoints (further
+  // feeds are refused).
+  void SpiderCipherSessionFinish(SpiderCipherSession *session);
+
+#ifdef __cplusplus
+}
+#endif
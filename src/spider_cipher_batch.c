@@ -0,0 +1,312 @@
+#include <string.h>
+
+#include "spider_cipher_batch.h"
+#include "spider_cipher_internal.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SPIDER_CIPHER_BATCH_AVX2 1
+#include <immintrin.h>
+#else
+#define SPIDER_CIPHER_BATCH_AVX2 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  //
+  // One step of every lane.  With only ats the cipher needs
+  //
+  //   top     - card at CUT_ZTH: the card whose at is CUT_ZTH.
+  //   tagAt   - ats[(card at TAG_ZTH + TAG_ADD) % 40].
+  //   noise   - the card whose at is tagAt+1.
+  //   cutAt   - ats[(clear+top) % 40], after the first cut and
+  //             the shuffle.
+  //
+  // and then every at moves as in SpiderCipherCutShuffleCutDeck:
+  //
+  //   at = (BACK_FRONT_ATS[(at - tagAt) % 40] - cutAt) % 40
+  //
+  // Finding "the card whose at is x" and "ats[card]" is a pass
+  // over the 40 rows comparing every lane at once.
+  //
+  // unscramble - in is scrambled (else clear), out is the other.
+  // advance    - advance by the clear card after.
+  //
+
+  static void SpiderCipherBatchStepScalar(SpiderCipherDeckBatch *batch,
+					  const SpiderCipherCard *in,
+					  SpiderCipherCard *out,
+					  int unscramble,
+					  int advance) {
+    uint8_t lanes = batch->lanes;
+    uint8_t top[SPIDER_CIPHER_BATCH_LANES];
+    uint8_t tag[SPIDER_CIPHER_BATCH_LANES];
+    uint8_t tagAt[SPIDER_CIPHER_BATCH_LANES];
+    uint8_t noise[SPIDER_CIPHER_BATCH_LANES];
+    uint8_t cutAt[SPIDER_CIPHER_BATCH_LANES];
+
+    for (uint8_t c=0; c<SPIDER_CIPHER_CARDS; ++c) {
+      for (uint8_t l=0; l<lanes; ++l) {
+	uint8_t at = batch->ats[c][l];
+	if (at == SPIDER_CIPHER_CUT_ZTH) top[l]=c;
+	if (at == SPIDER_CIPHER_TAG_ZTH) tag[l]=c;
+      }
+    }
+    for (uint8_t l=0; l<lanes; ++l) {
+      tag[l] = (tag[l]+SPIDER_CIPHER_TAG_ADD) % SPIDER_CIPHER_CARDS;
+      tagAt[l] = batch->ats[tag[l]][l];
+    }
+    for (uint8_t c=0; c<SPIDER_CIPHER_CARDS; ++c) {
+      for (uint8_t l=0; l<lanes; ++l) {
+	if (batch->ats[c][l] == (tagAt[l]+1) % SPIDER_CIPHER_CARDS) noise[l]=c;
+      }
+    }
+    for (uint8_t l=0; l<lanes; ++l) {
+      uint8_t clear;
+      if (unscramble) {
+	clear = (in[l]+(SPIDER_CIPHER_CARDS-noise[l])) % SPIDER_CIPHER_CARDS;
+	if (out != NULL) out[l] = clear;
+      } else {
+	clear = in[l];
+	if (out != NULL) out[l] = (clear+noise[l]) % SPIDER_CIPHER_CARDS;
+      }
+      cutAt[l] = (clear+top[l]) % SPIDER_CIPHER_CARDS;
+    }
+    if (advance) {
+      for (uint8_t l=0; l<lanes; ++l) {
+	uint8_t at = (batch->ats[cutAt[l]][l]+(SPIDER_CIPHER_CARDS-tagAt[l])) % SPIDER_CIPHER_CARDS;
+	cutAt[l] = (at & 1) ? SPIDER_CIPHER_CARDS/2-1-at/2 : SPIDER_CIPHER_CARDS/2+at/2;
+      }
+      for (uint8_t c=0; c<SPIDER_CIPHER_CARDS; ++c) {
+	for (uint8_t l=0; l<lanes; ++l) {
+	  uint8_t at = (batch->ats[c][l]+(SPIDER_CIPHER_CARDS-tagAt[l])) % SPIDER_CIPHER_CARDS;
+	  at = (at & 1) ? SPIDER_CIPHER_CARDS/2-1-at/2 : SPIDER_CIPHER_CARDS/2+at/2;
+	  batch->ats[c][l] = (at+(SPIDER_CIPHER_CARDS-cutAt[l])) % SPIDER_CIPHER_CARDS;
+	}
+      }
+    }
+    memset(top,0,sizeof(top));
+    memset(tag,0,sizeof(tag));
+    memset(tagAt,0,sizeof(tagAt));
+    memset(noise,0,sizeof(noise));
+    memset(cutAt,0,sizeof(cutAt));
+  }
+
+#if SPIDER_CIPHER_BATCH_AVX2
+
+#define SPIDER_CIPHER_AVX2_BATCH __attribute__((target("avx2")))
+#define SPIDER_CIPHER_INLINE static inline __attribute__((always_inline))
+
+  // v % 40 for v in 0..79
+  SPIDER_CIPHER_AVX2_BATCH SPIDER_CIPHER_INLINE
+  __m256i SpiderCipherBatchMod40AVX2(__m256i v) {
+    return _mm256_min_epu8(v,_mm256_sub_epi8(v,_mm256_set1_epi8(SPIDER_CIPHER_CARDS)));
+  }
+
+  // BACK_FRONT_ATS[at]: 20+at/2 for even at, 19-at/2 for odd at.
+  SPIDER_CIPHER_AVX2_BATCH SPIDER_CIPHER_INLINE
+  __m256i SpiderCipherBatchBackFrontAtsAVX2(__m256i at) {
+    __m256i half = _mm256_and_si256(_mm256_srli_epi16(at,1),_mm256_set1_epi8(0x7f));
+    __m256i odd = _mm256_cmpeq_epi8(_mm256_and_si256(at,_mm256_set1_epi8(1)),
+				    _mm256_set1_epi8(1));
+    return _mm256_blendv_epi8(_mm256_add_epi8(_mm256_set1_epi8(SPIDER_CIPHER_CARDS/2),half),
+			      _mm256_sub_epi8(_mm256_set1_epi8(SPIDER_CIPHER_CARDS/2-1),half),
+			      odd);
+  }
+
+  SPIDER_CIPHER_AVX2_BATCH
+  static void SpiderCipherBatchStepAVX2(SpiderCipherDeckBatch *batch,
+					const SpiderCipherCard *in,
+					SpiderCipherCard *out,
+					int unscramble,
+					int advance) {
+    const __m256i forty = _mm256_set1_epi8(SPIDER_CIPHER_CARDS);
+    const __m256i cutZth = _mm256_set1_epi8(SPIDER_CIPHER_CUT_ZTH);
+    const __m256i tagZth = _mm256_set1_epi8(SPIDER_CIPHER_TAG_ZTH);
+    __m256i ats[SPIDER_CIPHER_CARDS];
+    __m256i top = _mm256_setzero_si256();
+    __m256i tag = _mm256_setzero_si256();
+    __m256i tagAt = _mm256_setzero_si256();
+    __m256i noise = _mm256_setzero_si256();
+    __m256i cutAt = _mm256_setzero_si256();
+    __m256i clear;
+    uint8_t io[SPIDER_CIPHER_BATCH_LANES] = {0};
+
+    for (uint8_t c=0; c<SPIDER_CIPHER_CARDS; ++c) {
+      __m256i card = _mm256_set1_epi8(c);
+      ats[c] = _mm256_loadu_si256((const __m256i*)batch->ats[c]);
+      top = _mm256_or_si256(top,_mm256_and_si256(_mm256_cmpeq_epi8(ats[c],cutZth),card));
+      tag = _mm256_or_si256(tag,_mm256_and_si256(_mm256_cmpeq_epi8(ats[c],tagZth),card));
+    }
+    tag = SpiderCipherBatchMod40AVX2(_mm256_add_epi8(tag,_mm256_set1_epi8(SPIDER_CIPHER_TAG_ADD)));
+    for (uint8_t c=0; c<SPIDER_CIPHER_CARDS; ++c) {
+      __m256i is = _mm256_cmpeq_epi8(tag,_mm256_set1_epi8(c));
+      tagAt = _mm256_or_si256(tagAt,_mm256_and_si256(is,ats[c]));
+    }
+    __m256i noiseAt = SpiderCipherBatchMod40AVX2(_mm256_add_epi8(tagAt,_mm256_set1_epi8(1)));
+    for (uint8_t c=0; c<SPIDER_CIPHER_CARDS; ++c) {
+      __m256i is = _mm256_cmpeq_epi8(ats[c],noiseAt);
+      noise = _mm256_or_si256(noise,_mm256_and_si256(is,_mm256_set1_epi8(c)));
+    }
+
+    memcpy(io,in,batch->lanes);
+    __m256i given = _mm256_loadu_si256((const __m256i*)io);
+    if (unscramble) {
+      clear = SpiderCipherBatchMod40AVX2(_mm256_add_epi8(given,_mm256_sub_epi8(forty,noise)));
+      _mm256_storeu_si256((__m256i*)io,clear);
+    } else {
+      clear = given;
+      _mm256_storeu_si256((__m256i*)io,
+			  SpiderCipherBatchMod40AVX2(_mm256_add_epi8(given,noise)));
+    }
+    if (out != NULL) memcpy(out,io,batch->lanes);
+
+    if (advance) {
+      __m256i untag = _mm256_sub_epi8(forty,tagAt);
+      __m256i cut = SpiderCipherBatchMod40AVX2(_mm256_add_epi8(clear,top));
+      for (uint8_t c=0; c<SPIDER_CIPHER_CARDS; ++c) {
+	__m256i is = _mm256_cmpeq_epi8(cut,_mm256_set1_epi8(c));
+	cutAt = _mm256_or_si256(cutAt,_mm256_and_si256(is,ats[c]));
+      }
+      cutAt = SpiderCipherBatchMod40AVX2(_mm256_add_epi8(cutAt,untag));
+      cutAt = SpiderCipherBatchBackFrontAtsAVX2(cutAt);
+      __m256i uncut = _mm256_sub_epi8(forty,cutAt);
+      for (uint8_t c=0; c<SPIDER_CIPHER_CARDS; ++c) {
+	__m256i at = SpiderCipherBatchMod40AVX2(_mm256_add_epi8(ats[c],untag));
+	at = SpiderCipherBatchBackFrontAtsAVX2(at);
+	at = SpiderCipherBatchMod40AVX2(_mm256_add_epi8(at,uncut));
+	_mm256_storeu_si256((__m256i*)batch->ats[c],at);
+      }
+    }
+    memset(io,0,sizeof(io));
+  }
+
+#endif
+
+  // Only the AVX2 step beats running the lanes one deck at a time.
+  static int SpiderCipherBatchVectorized(void) {
+#if SPIDER_CIPHER_BATCH_AVX2
+    return SpiderCipherEngine() == SPIDER_CIPHER_ENGINE_AVX2;
+#else
+    return 0;
+#endif
+  }
+
+  static void SpiderCipherBatchStep(SpiderCipherDeckBatch *batch,
+				    const SpiderCipherCard *in,
+				    SpiderCipherCard *out,
+				    int unscramble,
+				    int advance) {
+#if SPIDER_CIPHER_BATCH_AVX2
+    if (SpiderCipherBatchVectorized()) {
+      SpiderCipherBatchStepAVX2(batch,in,out,unscramble,advance);
+      return;
+    }
+#endif
+    SpiderCipherBatchStepScalar(batch,in,out,unscramble,advance);
+  }
+
+  int SpiderCipherDeckBatchInit(SpiderCipherDeckBatch *batch, int lanes) {
+    if (lanes != 8 && lanes != 16 && lanes != 32) return 0;
+    batch->lanes = lanes;
+    for (uint8_t c=0; c<SPIDER_CIPHER_CARDS; ++c) {
+      memset(batch->ats[c],c,SPIDER_CIPHER_BATCH_LANES);
+    }
+    return 1;
+  }
+
+  void SpiderCipherDeckBatchSet(SpiderCipherDeckBatch *batch,
+				int lane,
+				SpiderCipherDeck *deck) {
+    if (lane < 0 || lane >= batch->lanes) return;
+    for (uint8_t c=0; c<SPIDER_CIPHER_CARDS; ++c) {
+      batch->ats[c][lane] = deck->ats[c];
+    }
+  }
+
+  void SpiderCipherDeckBatchGet(SpiderCipherDeckBatch *batch,
+				int lane,
+				SpiderCipherDeck *deck) {
+    if (lane < 0 || lane >= batch->lanes) return;
+    for (uint8_t c=0; c<SPIDER_CIPHER_CARDS; ++c) {
+      deck->ats[c] = batch->ats[c][lane];
+      deck->cards[deck->ats[c]] = c;
+    }
+  }
+
+  void SpiderCipherBatchScramble(SpiderCipherDeckBatch *batch,
+				 const SpiderCipherCard *clear,
+				 SpiderCipherCard *scrambled) {
+    SpiderCipherBatchStep(batch,clear,scrambled,0,0);
+  }
+
+  void SpiderCipherBatchUnscramble(SpiderCipherDeckBatch *batch,
+				   const SpiderCipherCard *scrambled,
+				   SpiderCipherCard *clear) {
+    SpiderCipherBatchStep(batch,scrambled,clear,1,0);
+  }
+
+  void SpiderCipherBatchAdvanceDeck(SpiderCipherDeckBatch *batch,
+				    const SpiderCipherCard *clear) {
+    SpiderCipherBatchStep(batch,clear,NULL,0,1);
+  }
+
+  static void SpiderCipherBatchBuffer(SpiderCipherDeckBatch *batch,
+				      const SpiderCipherCard *const *in,
+				      SpiderCipherCard *const *out,
+				      size_t n,
+				      int unscramble) {
+    uint8_t lanes = batch->lanes;
+
+    // Without AVX2 each lane runs as its own deck's buffer.  The
+    // engine is looked up once, not per card.
+    if (!SpiderCipherBatchVectorized()) {
+      SpiderCipherDeck deck;
+      for (uint8_t l=0; l<lanes; ++l) {
+	SpiderCipherDeckBatchGet(batch,l,&deck);
+	if (unscramble) {
+	  SpiderCipherUnscrambleBuffer(&deck,in[l],out[l],n);
+	} else {
+	  SpiderCipherScrambleBuffer(&deck,in[l],out[l],n);
+	}
+	SpiderCipherDeckBatchSet(batch,l,&deck);
+      }
+      SpiderCipherDeckInit(&deck);
+      return;
+    }
+
+#if SPIDER_CIPHER_BATCH_AVX2
+    SpiderCipherCard given[SPIDER_CIPHER_BATCH_LANES];
+    SpiderCipherCard result[SPIDER_CIPHER_BATCH_LANES];
+    for (size_t i=0; i<n; ++i) {
+      for (uint8_t l=0; l<lanes; ++l) {
+	given[l] = in[l][i];
+      }
+      SpiderCipherBatchStepAVX2(batch,given,result,unscramble,1);
+      for (uint8_t l=0; l<lanes; ++l) {
+	out[l][i] = result[l];
+      }
+    }
+    memset(given,0,sizeof(given));
+    memset(result,0,sizeof(result));
+#endif
+  }
+
+  void SpiderCipherBatchScrambleBuffer(SpiderCipherDeckBatch *batch,
+				       const SpiderCipherCard *const *in,
+				       SpiderCipherCard *const *out,
+				       size_t n) {
+    SpiderCipherBatchBuffer(batch,in,out,n,0);
+  }
+
+  void SpiderCipherBatchUnscrambleBuffer(SpiderCipherDeckBatch *batch,
+					 const SpiderCipherCard *const *in,
+					 SpiderCipherCard *const *out,
+					 size_t n) {
+    SpiderCipherBatchBuffer(batch,in,out,n,1);
+  }
+
+#ifdef __cplusplus
+}
+#endif
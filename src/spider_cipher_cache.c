@@ -0,0 +1,105 @@
+#include <string.h>
+
+#include "spider_cipher_cache.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  // memset the compiler may not drop, even right before reuse.
+  static void SpiderCipherSecureZero(void *data, size_t size) {
+    volatile uint8_t *bytes = (volatile uint8_t*) data;
+    for (size_t i=0; i<size; ++i) {
+      bytes[i]=0;
+    }
+  }
+
+  // Multiply-xor of the key as five 64 bit words (independent
+  // multiplies, no byte at a time chain), never 0 (0 marks an empty
+  // slot).
+  static uint32_t SpiderCipherDeckCacheHash(const SpiderCipherCard *key) {
+    static const uint64_t odd[SPIDER_CIPHER_CARDS/8] = {
+      0x9e3779b97f4a7c15ull, 0xc2b2ae3d27d4eb4full, 0x165667b19e3779f9ull,
+      0xd6e8feb86659fd93ull, 0xff51afd7ed558ccdull
+    };
+    uint64_t words[SPIDER_CIPHER_CARDS/8];
+    uint64_t hash = 0;
+    memcpy(words,key,SPIDER_CIPHER_CARDS);
+    for (int i=0; i<SPIDER_CIPHER_CARDS/8; ++i) {
+      hash ^= (words[i]^(words[i]>>29))*odd[i];
+    }
+    hash ^= hash>>32;
+    return (uint32_t) hash ? (uint32_t) hash : 1;
+  }
+
+  void SpiderCipherDeckCacheInit(SpiderCipherDeckCache *cache) {
+    SpiderCipherSecureZero(cache,sizeof(SpiderCipherDeckCache));
+  }
+
+  int SpiderCipherDeckCacheGet(SpiderCipherDeckCache *cache,
+			       const SpiderCipherCard *key,
+			       SpiderCipherDeck *deck) {
+    uint32_t hash = SpiderCipherDeckCacheHash(key);
+    size_t home = hash & (SPIDER_CIPHER_DECK_CACHE_SLOTS-1);
+    size_t slot = SPIDER_CIPHER_DECK_CACHE_SLOTS;
+
+    // slots only go from empty to full (evictions reuse in place), so
+    // the key cannot be past the first empty slot.
+    for (size_t way=0; way<SPIDER_CIPHER_DECK_CACHE_WAYS; ++way) {
+      size_t at = (home+way) & (SPIDER_CIPHER_DECK_CACHE_SLOTS-1);
+      if (cache->hashes[at] == 0) {
+	slot = at;
+	break;
+      }
+      if (cache->hashes[at] == hash &&
+	  memcmp(cache->entries[at].deck.cards,key,SPIDER_CIPHER_CARDS) == 0) {
+	memcpy(deck,&cache->entries[at].deck,sizeof(SpiderCipherDeck));
+	cache->referenced[at]=1;
+	++cache->hits;
+	return 1;
+      }
+    }
+
+    ++cache->misses;
+    if (!SpiderCipherDeckInitFromArray(deck,key)) {
+      return 0;
+    }
+
+    if (slot == SPIDER_CIPHER_DECK_CACHE_SLOTS) {
+      // second chance over the ways, starting at the hand.
+      for (size_t sweep=0; ; ++sweep) {
+	size_t at = (home+(cache->hand+sweep) % SPIDER_CIPHER_DECK_CACHE_WAYS)
+	  & (SPIDER_CIPHER_DECK_CACHE_SLOTS-1);
+	if (!cache->referenced[at]) {
+	  slot = at;
+	  cache->hand = (cache->hand+sweep+1) % SPIDER_CIPHER_DECK_CACHE_WAYS;
+	  break;
+	}
+	cache->referenced[at]=0;
+      }
+      SpiderCipherSecureZero(&cache->entries[slot],sizeof(SpiderCipherDeckCacheEntry));
+      ++cache->evictions;
+    }
+
+    memcpy(&cache->entries[slot].deck,deck,sizeof(SpiderCipherDeck));
+    cache->hashes[slot]=hash;
+    cache->referenced[slot]=0;
+    return 1;
+  }
+
+  int SpiderCipherDeckCacheGetBy(SpiderCipherDeckCache *cache,
+				 SpiderCipherCard (*f)(uint8_t at, void *misc),
+				 void *misc,
+				 SpiderCipherDeck *deck) {
+    SpiderCipherCard key[SPIDER_CIPHER_CARDS];
+    for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+      key[i] = f ? f(i,misc) : i;
+    }
+    int ok = SpiderCipherDeckCacheGet(cache,key,deck);
+    SpiderCipherSecureZero(key,sizeof(key));
+    return ok;
+  }
+
+#ifdef __cplusplus
+}
+#endif
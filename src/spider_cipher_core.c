@@ -1,8 +1,9 @@
-#include "spider_cipher_core.h"
+#include <stdatomic.h>
+#include <string.h>
 
-#define SPIDER_CIPHER_CUT_ZTH  0
-#define SPIDER_CIPHER_TAG_ZTH  2
-#define SPIDER_CIPHER_TAG_ADD 39
+#include "spider_cipher_core.h"
+#include "spider_cipher_internal.h"
+#include "spider_cipher_simd.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -15,13 +16,114 @@ extern "C" {
   static SpiderCipherCard SpiderCipherCutCard(SpiderCipherDeck *deck,
 				       SpiderCipherCard clear);
   
-  static void SpiderCipherCutDeck(SpiderCipherDeck *inputDeck,
-			   SpiderCipherCard cutCard,
-			   SpiderCipherDeck *outputDeck);
-  
-  static void SpiderCipherBackFrontShuffleDeck(SpiderCipherDeck *inputDeck,
+  static void SpiderCipherCutShuffleCutDeck(SpiderCipherDeck *inputDeck,
+					    SpiderCipherCard tagCard,
+					    SpiderCipherCard cutCard,
+					    SpiderCipherDeck *outputDeck,
+					    const SpiderCipherEngineOps *ops);
+
+  static void SpiderCipherAdvanceDeckTo(SpiderCipherDeck *deck,
+					SpiderCipherCard clear,
+					SpiderCipherDeck *next,
+					const SpiderCipherEngineOps *ops);
+
+  static void SpiderCipherCutDeckScalar(SpiderCipherDeck *inputDeck,
+					uint8_t cutAt,
 					SpiderCipherDeck *outputDeck);
 
+  static void SpiderCipherBackFrontShuffleDeckScalar(SpiderCipherDeck *inputDeck,
+						     SpiderCipherDeck *outputDeck);
+
+  static void SpiderCipherCutShuffleCutDeckScalar(SpiderCipherDeck *inputDeck,
+						  uint8_t tagAt,
+						  uint8_t cutAt,
+						  SpiderCipherDeck *outputDeck);
+
+  static void SpiderCipherCutShuffleCutCardsScalar(SpiderCipherCard *input,
+						   uint8_t tagAt,
+						   uint8_t cutAt,
+						   SpiderCipherCard *output);
+
+  static uint8_t SpiderCipherFindCardScalar(SpiderCipherCard *cards,
+					    SpiderCipherCard card);
+
+  static const SpiderCipherEngineOps SPIDER_CIPHER_ENGINE_OPS_SCALAR =
+    {
+     SPIDER_CIPHER_ENGINE_SCALAR,
+     "scalar",
+     SpiderCipherCutDeckScalar,
+     SpiderCipherBackFrontShuffleDeckScalar,
+     SpiderCipherCutShuffleCutDeckScalar,
+     SpiderCipherCutShuffleCutCardsScalar,
+     SpiderCipherFindCardScalar
+    };
+
+  static const SpiderCipherEngineOps SPIDER_CIPHER_ENGINE_OPS_TABLE =
+    {
+     SPIDER_CIPHER_ENGINE_TABLE,
+     "table",
+     SpiderCipherCutDeckScalar,
+     SpiderCipherBackFrontShuffleDeckScalar,
+     SpiderCipherCutShuffleCutDeckTable,
+     SpiderCipherCutShuffleCutCardsTable,
+     SpiderCipherFindCardScalar
+    };
+
+  // Selected engine, NULL until the first use or select.  Atomic,
+  // as threads may pick (the same) AUTO engine at once or select
+  // while others scramble: release on store, acquire on load.
+  static _Atomic(const SpiderCipherEngineOps *) spiderCipherEngineOps = NULL;
+
+  static const SpiderCipherEngineOps *SpiderCipherEngineOpsFor(int engine) {
+    const SpiderCipherEngineOps *ops = NULL;
+    switch (engine) {
+    case SPIDER_CIPHER_ENGINE_AUTO:
+      ops = SpiderCipherEngineOpsAVX2();
+      if (ops == NULL) ops = SpiderCipherEngineOpsSSE41();
+      if (ops == NULL) ops = &SPIDER_CIPHER_ENGINE_OPS_SCALAR;
+      break;
+    case SPIDER_CIPHER_ENGINE_SCALAR:
+      ops = &SPIDER_CIPHER_ENGINE_OPS_SCALAR;
+      break;
+    case SPIDER_CIPHER_ENGINE_SSE41:
+      ops = SpiderCipherEngineOpsSSE41();
+      break;
+    case SPIDER_CIPHER_ENGINE_AVX2:
+      ops = SpiderCipherEngineOpsAVX2();
+      break;
+    case SPIDER_CIPHER_ENGINE_TABLE:
+      ops = &SPIDER_CIPHER_ENGINE_OPS_TABLE;
+      break;
+    }
+    return ops;
+  }
+
+  static const SpiderCipherEngineOps *SpiderCipherOps(void) {
+    const SpiderCipherEngineOps *ops =
+      atomic_load_explicit(&spiderCipherEngineOps,memory_order_acquire);
+    if (ops == NULL) {
+      // a select that got in first wins.
+      const SpiderCipherEngineOps *none = NULL;
+      ops = SpiderCipherEngineOpsFor(SPIDER_CIPHER_ENGINE_AUTO);
+      if (!atomic_compare_exchange_strong_explicit(&spiderCipherEngineOps,&none,ops,
+						   memory_order_acq_rel,memory_order_acquire)) {
+	ops = none;
+      }
+    }
+    return ops;
+  }
+
+  int SpiderCipherEngineSelect(int engine) {
+    const SpiderCipherEngineOps *ops = SpiderCipherEngineOpsFor(engine);
+    if (ops == NULL) return 0;
+    atomic_store_explicit(&spiderCipherEngineOps,ops,memory_order_release);
+    return 1;
+  }
+
+  int SpiderCipherEngine(void) {
+    return SpiderCipherOps()->engine;
+  }
+
   void SpiderCipherDeckInit(SpiderCipherDeck *deck) {
     for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
       deck->cards[i]=i;
@@ -32,18 +134,36 @@ extern "C" {
   int SpiderCipherDeckInitBy(SpiderCipherDeck *deck,
 			      SpiderCipherCard (*f)(uint8_t at, void *misc),
 			      void *misc) {
-    for (uint8_t card=0; card<SPIDER_CIPHER_CARDS; ++card) {
-      deck->ats[card]=SPIDER_CIPHER_CARDS;      
+    SpiderCipherCard key[SPIDER_CIPHER_CARDS];
+    for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+      key[i] = f ? f(i,misc) : i;
     }
-    
+    int ok = SpiderCipherDeckInitFromArray(deck,key);
+    memset(key,0,sizeof(key));
+    return ok;
+  }
+
+  //
+  // Every card sets its bit in a 64 bit mask (cards past 63 set
+  // none), so the key is a permutation exactly when the mask is the
+  // low 40 bits: no branch per card, and the ats are only built
+  // once the key is known to be good.
+  //
+  int SpiderCipherDeckInitFromArray(SpiderCipherDeck *deck,
+				    const SpiderCipherCard key[SPIDER_CIPHER_CARDS]) {
+    uint64_t seen = 0;
     for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
-      SpiderCipherCard card = f ? f(i,misc) : i;
-      if (card >= SPIDER_CIPHER_CARDS) return 0;
-      if (deck->ats[card] != SPIDER_CIPHER_CARDS) return 0;
+      SpiderCipherCard card = key[i];
+      seen |= (uint64_t) (card < 64) << (card & 63);
       deck->cards[i]=card;
-      deck->ats[card]=i;
     }
-
+    if (seen != (((uint64_t) 1) << SPIDER_CIPHER_CARDS)-1) {
+      SpiderCipherDeckInit(deck);
+      return 0;
+    }
+    for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+      deck->ats[key[i]]=i;
+    }
     return 1;
   }
 
@@ -67,15 +187,245 @@ extern "C" {
   void SpiderCipherAdvanceDeck(SpiderCipherDeck *deck,
 			       SpiderCipherCard clear,
 			       SpiderCipherDeck *spare) {
+    SpiderCipherAdvanceDeckTo(deck,clear,spare,SpiderCipherOps());
+    SpiderCipherCopyDeck(spare,deck);
+  }
+
+  //
+  // Advance deck into next, leaving deck as it was.
+  //
+  static void SpiderCipherAdvanceDeckTo(SpiderCipherDeck *deck,
+					SpiderCipherCard clear,
+					SpiderCipherDeck *next,
+					const SpiderCipherEngineOps *ops) {
     SpiderCipherCard tagCard = SpiderCipherTagCard(deck);
     SpiderCipherCard cutCard = SpiderCipherCutCard(deck,clear);
-    SpiderCipherCutDeck(deck,tagCard,spare);
-    SpiderCipherBackFrontShuffleDeck(spare,deck);
-    SpiderCipherCutDeck(deck,cutCard,spare);
-    SpiderCipherCopyDeck(spare,deck);
+    SpiderCipherCutShuffleCutDeck(deck,tagCard,cutCard,next,ops);
     tagCard=cutCard=0;
   }
+
+  //
+  // The buffer versions work on local copies of the deck so
+  // the compiler knows out[] cannot alias it, and keeps both
+  // decks in L1 (or registers) for the whole packet.  The two
+  // copies take turns as deck and spare, so no copy per card, and
+  // the engine is looked up once per packet.
+  //
+  void SpiderCipherScrambleBuffer(SpiderCipherDeck *deck,
+				  const SpiderCipherCard *in,
+				  SpiderCipherCard *out,
+				  size_t n) {
+    const SpiderCipherEngineOps *ops = SpiderCipherOps();
+    SpiderCipherDeck work[2];
+    SpiderCipherDeck *now = &work[0], *next = &work[1], *tmp;
+    SpiderCipherCopyDeck(deck,now);
+    for (size_t i=0; i<n; ++i) {
+      SpiderCipherCard clear = in[i];
+      out[i] = SpiderCipherScramble(now,clear);
+      SpiderCipherAdvanceDeckTo(now,clear,next,ops);
+      tmp=now; now=next; next=tmp;
+    }
+    SpiderCipherCopyDeck(now,deck);
+    SpiderCipherDeckInit(&work[0]);
+    SpiderCipherDeckInit(&work[1]);
+  }
+
+  void SpiderCipherUnscrambleBuffer(SpiderCipherDeck *deck,
+				    const SpiderCipherCard *in,
+				    SpiderCipherCard *out,
+				    size_t n) {
+    const SpiderCipherEngineOps *ops = SpiderCipherOps();
+    SpiderCipherDeck work[2];
+    SpiderCipherDeck *now = &work[0], *next = &work[1], *tmp;
+    SpiderCipherCopyDeck(deck,now);
+    for (size_t i=0; i<n; ++i) {
+      SpiderCipherCard clear = SpiderCipherUnscramble(now,in[i]);
+      out[i] = clear;
+      SpiderCipherAdvanceDeckTo(now,clear,next,ops);
+      tmp=now; now=next; next=tmp;
+    }
+    SpiderCipherCopyDeck(now,deck);
+    SpiderCipherDeckInit(&work[0]);
+    SpiderCipherDeckInit(&work[1]);
+  }
   
+  //
+  // Deck kinds
+  //
+  // The Lazy and Rotated decks share the cipher's outer loops: given
+  // static SpiderCipher<Kind>NoiseCard(deck,ops) and
+  // SpiderCipher<Kind>AdvanceDeckTo(deck,clear,next,ops), this
+  // defines the public Scramble, Unscramble, AdvanceDeck and buffer
+  // functions of SpiderCipher<Kind>Deck.
+  //
+#define SPIDER_CIPHER_DECK_KIND(Kind)					\
+  SpiderCipherCard SpiderCipher##Kind##Scramble(SpiderCipher##Kind##Deck *deck, \
+						SpiderCipherCard clear) { \
+    return (clear+SpiderCipher##Kind##NoiseCard(deck,SpiderCipherOps())) \
+      % SPIDER_CIPHER_CARDS;						\
+  }									\
+									\
+  SpiderCipherCard SpiderCipher##Kind##Unscramble(SpiderCipher##Kind##Deck *deck, \
+						  SpiderCipherCard scrambled) { \
+    return (scrambled+(SPIDER_CIPHER_CARDS-SpiderCipher##Kind##NoiseCard(deck,SpiderCipherOps()))) \
+      % SPIDER_CIPHER_CARDS;						\
+  }									\
+									\
+  void SpiderCipher##Kind##AdvanceDeck(SpiderCipher##Kind##Deck *deck, \
+				       SpiderCipherCard clear,		\
+				       SpiderCipher##Kind##Deck *spare) { \
+    SpiderCipher##Kind##AdvanceDeckTo(deck,clear,spare,SpiderCipherOps()); \
+    memcpy(deck,spare,sizeof(SpiderCipher##Kind##Deck));		\
+  }									\
+									\
+  void SpiderCipher##Kind##ScrambleBuffer(SpiderCipher##Kind##Deck *deck, \
+					  const SpiderCipherCard *in,	\
+					  SpiderCipherCard *out,	\
+					  size_t n) {			\
+    const SpiderCipherEngineOps *ops = SpiderCipherOps();		\
+    SpiderCipher##Kind##Deck work[2];					\
+    SpiderCipher##Kind##Deck *now = &work[0], *next = &work[1], *tmp;	\
+    memcpy(now,deck,sizeof(SpiderCipher##Kind##Deck));			\
+    for (size_t i=0; i<n; ++i) {					\
+      SpiderCipherCard clear = in[i];					\
+      out[i] = (clear+SpiderCipher##Kind##NoiseCard(now,ops)) % SPIDER_CIPHER_CARDS; \
+      SpiderCipher##Kind##AdvanceDeckTo(now,clear,next,ops);		\
+      tmp=now; now=next; next=tmp;					\
+    }									\
+    memcpy(deck,now,sizeof(SpiderCipher##Kind##Deck));			\
+    SpiderCipher##Kind##DeckInit(&work[0]);				\
+    SpiderCipher##Kind##DeckInit(&work[1]);				\
+  }									\
+									\
+  void SpiderCipher##Kind##UnscrambleBuffer(SpiderCipher##Kind##Deck *deck, \
+					    const SpiderCipherCard *in, \
+					    SpiderCipherCard *out,	\
+					    size_t n) {			\
+    const SpiderCipherEngineOps *ops = SpiderCipherOps();		\
+    SpiderCipher##Kind##Deck work[2];					\
+    SpiderCipher##Kind##Deck *now = &work[0], *next = &work[1], *tmp;	\
+    memcpy(now,deck,sizeof(SpiderCipher##Kind##Deck));			\
+    for (size_t i=0; i<n; ++i) {					\
+      SpiderCipherCard clear =						\
+	(in[i]+(SPIDER_CIPHER_CARDS-SpiderCipher##Kind##NoiseCard(now,ops))) % SPIDER_CIPHER_CARDS; \
+      out[i] = clear;							\
+      SpiderCipher##Kind##AdvanceDeckTo(now,clear,next,ops);		\
+      tmp=now; now=next; next=tmp;					\
+    }									\
+    memcpy(deck,now,sizeof(SpiderCipher##Kind##Deck));			\
+    SpiderCipher##Kind##DeckInit(&work[0]);				\
+    SpiderCipher##Kind##DeckInit(&work[1]);				\
+  }
+
+  //
+  // Lazy decks
+  //
+
+  void SpiderCipherLazyDeckInit(SpiderCipherLazyDeck *lazy) {
+    for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+      lazy->cards[i]=i;
+    }
+  }
+
+  void SpiderCipherLazyDeckFrom(SpiderCipherLazyDeck *lazy,
+				SpiderCipherDeck *deck) {
+    memcpy(lazy->cards,deck->cards,SPIDER_CIPHER_CARDS);
+  }
+
+  void SpiderCipherDeckFromLazy(SpiderCipherDeck *deck,
+				SpiderCipherLazyDeck *lazy) {
+    for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+      deck->cards[i]=lazy->cards[i];
+      deck->ats[lazy->cards[i]]=i;
+    }
+  }
+
+  static SpiderCipherCard SpiderCipherLazyNoiseCard(SpiderCipherLazyDeck *deck,
+						    const SpiderCipherEngineOps *ops) {
+    SpiderCipherCard tagCard =
+      (deck->cards[SPIDER_CIPHER_TAG_ZTH]+SPIDER_CIPHER_TAG_ADD)%SPIDER_CIPHER_CARDS;
+    uint8_t noiseAt = ops->findCard(deck->cards,tagCard)+1;
+    if (noiseAt >= SPIDER_CIPHER_CARDS) noiseAt -= SPIDER_CIPHER_CARDS;
+    return deck->cards[noiseAt];
+  }
+
+  static void SpiderCipherLazyAdvanceDeckTo(SpiderCipherLazyDeck *deck,
+					    SpiderCipherCard clear,
+					    SpiderCipherLazyDeck *next,
+					    const SpiderCipherEngineOps *ops) {
+    SpiderCipherCard tagCard =
+      (deck->cards[SPIDER_CIPHER_TAG_ZTH]+SPIDER_CIPHER_TAG_ADD)%SPIDER_CIPHER_CARDS;
+    SpiderCipherCard cutCard =
+      (clear+deck->cards[SPIDER_CIPHER_CUT_ZTH])%SPIDER_CIPHER_CARDS;
+    uint8_t tagAt = ops->findCard(deck->cards,tagCard);
+    uint8_t cutAt = ops->findCard(deck->cards,cutCard)+(SPIDER_CIPHER_CARDS-tagAt);
+    if (cutAt >= SPIDER_CIPHER_CARDS) cutAt -= SPIDER_CIPHER_CARDS;
+    cutAt = SPIDER_CIPHER_BACK_FRONT_ATS[cutAt];
+    ops->cutShuffleCutCards(deck->cards,tagAt,cutAt,next->cards);
+    tagCard = cutCard = tagAt = cutAt = 0;
+  }
+
+  SPIDER_CIPHER_DECK_KIND(Lazy)
+
+  //
+  // Rotated decks
+  //
+  // Logical position i is physical position (i+offset) % 40, and
+  // neighbors stay neighbors, so the noise card is found without
+  // unrotating.  Cutting at a card makes its physical position the
+  // offset.  The shuffle is the engine's cut/shuffle/cut with the
+  // first cut at the offset and no second cut, leaving offset 0.
+  //
+
+  void SpiderCipherRotatedDeckInit(SpiderCipherRotatedDeck *rotated) {
+    SpiderCipherDeckInit(&rotated->deck);
+    rotated->offset = 0;
+  }
+
+  void SpiderCipherRotatedDeckFrom(SpiderCipherRotatedDeck *rotated,
+				   SpiderCipherDeck *deck) {
+    SpiderCipherCopyDeck(deck,&rotated->deck);
+    rotated->offset = 0;
+  }
+
+  void SpiderCipherDeckFromRotated(SpiderCipherDeck *deck,
+				   SpiderCipherRotatedDeck *rotated) {
+    SpiderCipherOps()->cutDeck(&rotated->deck,rotated->offset,deck);
+  }
+
+  static SpiderCipherCard SpiderCipherRotatedCard(SpiderCipherRotatedDeck *deck,
+						  uint8_t zth) {
+    uint8_t at = deck->offset+zth;
+    if (at >= SPIDER_CIPHER_CARDS) at -= SPIDER_CIPHER_CARDS;
+    return deck->deck.cards[at];
+  }
+
+  static SpiderCipherCard SpiderCipherRotatedNoiseCard(SpiderCipherRotatedDeck *deck,
+						       const SpiderCipherEngineOps *ops) {
+    (void) ops;
+    SpiderCipherCard tagCard =
+      (SpiderCipherRotatedCard(deck,SPIDER_CIPHER_TAG_ZTH)+SPIDER_CIPHER_TAG_ADD)%SPIDER_CIPHER_CARDS;
+    uint8_t noiseAt = deck->deck.ats[tagCard]+1;
+    if (noiseAt >= SPIDER_CIPHER_CARDS) noiseAt -= SPIDER_CIPHER_CARDS;
+    return deck->deck.cards[noiseAt];
+  }
+
+  static void SpiderCipherRotatedAdvanceDeckTo(SpiderCipherRotatedDeck *deck,
+					       SpiderCipherCard clear,
+					       SpiderCipherRotatedDeck *next,
+					       const SpiderCipherEngineOps *ops) {
+    SpiderCipherCard tagCard =
+      (SpiderCipherRotatedCard(deck,SPIDER_CIPHER_TAG_ZTH)+SPIDER_CIPHER_TAG_ADD)%SPIDER_CIPHER_CARDS;
+    SpiderCipherCard cutCard =
+      (clear+SpiderCipherRotatedCard(deck,SPIDER_CIPHER_CUT_ZTH))%SPIDER_CIPHER_CARDS;
+    uint8_t tagAt = deck->deck.ats[tagCard];
+    ops->cutShuffleCutDeck(&deck->deck,tagAt,0,&next->deck);
+    next->offset = next->deck.ats[cutCard];
+    tagCard = cutCard = tagAt = 0;
+  }
+
+  SPIDER_CIPHER_DECK_KIND(Rotated)
+
   static SpiderCipherCard SpiderCipherTagCard(SpiderCipherDeck *deck) {
     return (deck->cards[SPIDER_CIPHER_TAG_ZTH]+SPIDER_CIPHER_TAG_ADD)%SPIDER_CIPHER_CARDS;
   }
@@ -89,12 +439,32 @@ extern "C" {
     return (clear+deck->cards[SPIDER_CIPHER_CUT_ZTH])%SPIDER_CIPHER_CARDS;
   }
 
-  static void SpiderCipherCutDeck(SpiderCipherDeck *input,
-				  SpiderCipherCard cut,
-				  SpiderCipherDeck *output) {
-    if (cut >= SPIDER_CIPHER_CARDS) return;
-    
-    uint8_t cutAt = input->ats[cut];
+  //
+  // Cut at tagCard, BackFrontShuffle, then cut at cutCard as one
+  // permutation.
+  //
+  static void SpiderCipherCutShuffleCutDeck(SpiderCipherDeck *input,
+					    SpiderCipherCard tagCard,
+					    SpiderCipherCard cutCard,
+					    SpiderCipherDeck *output,
+					    const SpiderCipherEngineOps *ops) {
+    if (tagCard >= SPIDER_CIPHER_CARDS || cutCard >= SPIDER_CIPHER_CARDS) return;
+
+    uint8_t tagAt = input->ats[tagCard];
+    uint8_t cutAt = input->ats[cutCard]+(SPIDER_CIPHER_CARDS-tagAt);
+    if (cutAt >= SPIDER_CIPHER_CARDS) cutAt -= SPIDER_CIPHER_CARDS;
+    cutAt = SPIDER_CIPHER_BACK_FRONT_ATS[cutAt];
+    ops->cutShuffleCutDeck(input,tagAt,cutAt,output);
+    tagAt = cutAt = 0;
+  }
+
+  //
+  // Scalar (reference) engine.
+  //
+
+  static void SpiderCipherCutDeckScalar(SpiderCipherDeck *input,
+					uint8_t cutAt,
+					SpiderCipherDeck *output) {
     uint8_t uncutAt = (SPIDER_CIPHER_CARDS-cutAt) % SPIDER_CIPHER_CARDS;
     
     for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
@@ -107,8 +477,8 @@ extern "C" {
     uncutAt = 0;
   }
   
-  static void SpiderCipherBackFrontShuffleDeck(SpiderCipherDeck *input,
-					SpiderCipherDeck *output) {
+  static void SpiderCipherBackFrontShuffleDeckScalar(SpiderCipherDeck *input,
+						     SpiderCipherDeck *output) {
     {
       SpiderCipherCard *in = input->cards;
       SpiderCipherCard *out = output->cards+SPIDER_CIPHER_CARDS/2;
@@ -133,6 +503,63 @@ extern "C" {
       in=out=0;
     }
   }
+
+  //
+  // The card that lands at i comes from
+  //
+  //   at = (BACK_FRONT[(i + cutAt) % 40] + tagAt) % 40
+  //
+  // where tagAt is where the tag card is in the input and cutAt is
+  // where the cut card is after the first cut and shuffle.  The ats
+  // go through the same steps in reverse.
+  //
+  static void SpiderCipherCutShuffleCutDeckScalar(SpiderCipherDeck *input,
+						  uint8_t tagAt,
+						  uint8_t cutAt,
+						  SpiderCipherDeck *output) {
+    uint8_t untagAt = SPIDER_CIPHER_CARDS-tagAt;
+    uint8_t uncutAt = SPIDER_CIPHER_CARDS-cutAt;
+    uint8_t at;
+
+    for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+      at = i+cutAt;
+      if (at >= SPIDER_CIPHER_CARDS) at -= SPIDER_CIPHER_CARDS;
+      at = SPIDER_CIPHER_BACK_FRONT[at]+tagAt;
+      if (at >= SPIDER_CIPHER_CARDS) at -= SPIDER_CIPHER_CARDS;
+      output->cards[i]=input->cards[at];
+
+      at = input->ats[i]+untagAt;
+      if (at >= SPIDER_CIPHER_CARDS) at -= SPIDER_CIPHER_CARDS;
+      at = SPIDER_CIPHER_BACK_FRONT_ATS[at]+uncutAt;
+      if (at >= SPIDER_CIPHER_CARDS) at -= SPIDER_CIPHER_CARDS;
+      output->ats[i]=at;
+    }
+    tagAt = untagAt = cutAt = uncutAt = at = 0;
+  }
+
+  static void SpiderCipherCutShuffleCutCardsScalar(SpiderCipherCard *input,
+						   uint8_t tagAt,
+						   uint8_t cutAt,
+						   SpiderCipherCard *output) {
+    uint8_t at;
+
+    for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+      at = i+cutAt;
+      if (at >= SPIDER_CIPHER_CARDS) at -= SPIDER_CIPHER_CARDS;
+      at = SPIDER_CIPHER_BACK_FRONT[at]+tagAt;
+      if (at >= SPIDER_CIPHER_CARDS) at -= SPIDER_CIPHER_CARDS;
+      output[i]=input[at];
+    }
+    at = 0;
+  }
+
+  static uint8_t SpiderCipherFindCardScalar(SpiderCipherCard *cards,
+					    SpiderCipherCard card) {
+    for (uint8_t at=0; at<SPIDER_CIPHER_CARDS; ++at) {
+      if (cards[at] == card) return at;
+    }
+    return SPIDER_CIPHER_CARDS;
+  }
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "spider_cipher_core.h"
+
+//
+// Spider Cipher constants shared by the core and the code that
+// re-implements its steps (batch, random).
+//
+// The tag card is TAG_ADD past the card at TAG_ZTH, the noise card
+// is the one after the tag card, and the cut card is the clear card
+// plus the card at CUT_ZTH.
+//
+
+#define SPIDER_CIPHER_CUT_ZTH  0
+#define SPIDER_CIPHER_TAG_ZTH  2
+#define SPIDER_CIPHER_TAG_ADD 39
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  //
+  // BackFrontShuffle moves the card at SPIDER_CIPHER_BACK_FRONT[at]
+  // to at, and the card at at to SPIDER_CIPHER_BACK_FRONT_ATS[at].
+  //
+  static const uint8_t SPIDER_CIPHER_BACK_FRONT[SPIDER_CIPHER_CARDS] =
+    {
+     39,37,35,33,31,29,27,25,23,21,
+     19,17,15,13,11, 9, 7, 5, 3, 1,
+      0, 2, 4, 6, 8,10,12,14,16,18,
+     20,22,24,26,28,30,32,34,36,38
+    };
+
+  static const uint8_t SPIDER_CIPHER_BACK_FRONT_ATS[SPIDER_CIPHER_CARDS] =
+    {
+     20,19,21,18,22,17,23,16,24,15,
+     25,14,26,13,27,12,28,11,29,10,
+     30, 9,31, 8,32, 7,33, 6,34, 5,
+     35, 4,36, 3,37, 2,38, 1,39, 0
+    };
+
+#ifdef __cplusplus
+}
+#endif
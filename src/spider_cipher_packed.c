@@ -0,0 +1,263 @@
+#include <string.h>
+
+#include "spider_cipher_packed.h"
+
+// cards per scramble through the local buffer (a multiple of 4).
+#define SPIDER_CIPHER_PACKED_CHUNK 512
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SPIDER_CIPHER_PACKED_X86 1
+#include <immintrin.h>
+#else
+#define SPIDER_CIPHER_PACKED_X86 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  //
+  // Scalar, whole groups of 4 cards.
+  //
+
+  static void SpiderCipherPackScalar(const SpiderCipherCard *cards,
+				     uint8_t *packed,
+				     size_t groups) {
+    for (size_t g=0; g<groups; ++g) {
+      uint32_t v = (uint32_t) (cards[0] & 63) << 18 | (uint32_t) (cards[1] & 63) << 12
+	| (uint32_t) (cards[2] & 63) << 6 | (uint32_t) (cards[3] & 63);
+      packed[0]=v >> 16;
+      packed[1]=v >> 8;
+      packed[2]=v;
+      cards += 4;
+      packed += 3;
+    }
+  }
+
+  static uint8_t SpiderCipherUnpackScalar(const uint8_t *packed,
+					  SpiderCipherCard *cards,
+					  size_t groups) {
+    uint8_t bad = 0;
+    for (size_t g=0; g<groups; ++g) {
+      uint32_t v = (uint32_t) packed[0] << 16 | (uint32_t) packed[1] << 8 | packed[2];
+      cards[0]=v >> 18;
+      cards[1]=(v >> 12) & 63;
+      cards[2]=(v >> 6) & 63;
+      cards[3]=v & 63;
+      bad |= (cards[0] >= SPIDER_CIPHER_CARDS) | (cards[1] >= SPIDER_CIPHER_CARDS)
+	| (cards[2] >= SPIDER_CIPHER_CARDS) | (cards[3] >= SPIDER_CIPHER_CARDS);
+      cards += 4;
+      packed += 3;
+    }
+    return bad;
+  }
+
+#if SPIDER_CIPHER_PACKED_X86
+
+#define SPIDER_CIPHER_SSSE3_PACKED __attribute__((target("ssse3")))
+#define SPIDER_CIPHER_AVX2_PACKED __attribute__((target("avx2")))
+
+  //
+  // SSSE3, 16 cards to 12 bytes.  Pairs merge with pmaddubsw
+  // (a*64+b), pairs of pairs with pmaddwd ((a*64+b)*4096+c*64+d),
+  // and pshufb takes the 3 big endian bytes of each dword.  The
+  // stores write 16 bytes, so the callers stop 24 cards short.
+  //
+  SPIDER_CIPHER_SSSE3_PACKED
+  static size_t SpiderCipherPackSSSE3(const SpiderCipherCard *cards,
+				      uint8_t *packed,
+				      size_t n) {
+    const __m128i six = _mm_set1_epi8(63);
+    const __m128i merge = _mm_set1_epi32(0x01400140);
+    const __m128i merge2 = _mm_set1_epi32(0x00011000);
+    const __m128i bytes = _mm_setr_epi8(2,1,0,6,5,4,10,9,8,14,13,12,-1,-1,-1,-1);
+    size_t i = 0;
+    for (; i+24 <= n; i += 16) {
+      __m128i v = _mm_and_si128(_mm_loadu_si128((const __m128i*)(cards+i)),six);
+      v = _mm_madd_epi16(_mm_maddubs_epi16(v,merge),merge2);
+      _mm_storeu_si128((__m128i*)(packed+i/4*3),_mm_shuffle_epi8(v,bytes));
+    }
+    return i;
+  }
+
+  //
+  // 12 bytes to 16 cards: pshufb puts bytes 1,0,2,1 of each group
+  // in a dword, then the multiplies shift each 6 bits into its own
+  // byte.  The loads read 16 bytes.
+  //
+  SPIDER_CIPHER_SSSE3_PACKED
+  static size_t SpiderCipherUnpackSSSE3(const uint8_t *packed,
+					SpiderCipherCard *cards,
+					size_t n,
+					uint8_t *bad) {
+    const __m128i spread = _mm_setr_epi8(1,0,2,1,4,3,5,4,7,6,8,7,10,9,11,10);
+    const __m128i maskAC = _mm_set1_epi32(0x0fc0fc00);
+    const __m128i shiftAC = _mm_set1_epi32(0x04000040);
+    const __m128i maskBD = _mm_set1_epi32(0x003f03f0);
+    const __m128i shiftBD = _mm_set1_epi32(0x01000010);
+    const __m128i last = _mm_set1_epi8(SPIDER_CIPHER_CARDS-1);
+    __m128i over = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i+24 <= n; i += 16) {
+      __m128i v = _mm_loadu_si128((const __m128i*)(packed+i/4*3));
+      v = _mm_shuffle_epi8(v,spread);
+      v = _mm_or_si128(_mm_mulhi_epu16(_mm_and_si128(v,maskAC),shiftAC),
+		       _mm_mullo_epi16(_mm_and_si128(v,maskBD),shiftBD));
+      over = _mm_or_si128(over,_mm_cmpgt_epi8(v,last));
+      _mm_storeu_si128((__m128i*)(cards+i),v);
+    }
+    *bad |= _mm_movemask_epi8(over) != 0;
+    return i;
+  }
+
+  //
+  // AVX2, the same per 128 bit lane: 32 cards to 2x12 bytes, which
+  // vpermd moves together.  Stores write 32 bytes and loads read 28,
+  // so the callers stop 48 cards short.
+  //
+  SPIDER_CIPHER_AVX2_PACKED
+  static size_t SpiderCipherPackAVX2(const SpiderCipherCard *cards,
+				     uint8_t *packed,
+				     size_t n) {
+    const __m256i six = _mm256_set1_epi8(63);
+    const __m256i merge = _mm256_set1_epi32(0x01400140);
+    const __m256i merge2 = _mm256_set1_epi32(0x00011000);
+    const __m256i bytes = _mm256_setr_epi8(2,1,0,6,5,4,10,9,8,14,13,12,-1,-1,-1,-1,
+					   2,1,0,6,5,4,10,9,8,14,13,12,-1,-1,-1,-1);
+    const __m256i together = _mm256_setr_epi32(0,1,2,4,5,6,3,7);
+    size_t i = 0;
+    for (; i+48 <= n; i += 32) {
+      __m256i v = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(cards+i)),six);
+      v = _mm256_madd_epi16(_mm256_maddubs_epi16(v,merge),merge2);
+      v = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(v,bytes),together);
+      _mm256_storeu_si256((__m256i*)(packed+i/4*3),v);
+    }
+    return i;
+  }
+
+  SPIDER_CIPHER_AVX2_PACKED
+  static size_t SpiderCipherUnpackAVX2(const uint8_t *packed,
+				       SpiderCipherCard *cards,
+				       size_t n,
+				       uint8_t *bad) {
+    const __m256i spread = _mm256_setr_epi8(1,0,2,1,4,3,5,4,7,6,8,7,10,9,11,10,
+					    1,0,2,1,4,3,5,4,7,6,8,7,10,9,11,10);
+    const __m256i maskAC = _mm256_set1_epi32(0x0fc0fc00);
+    const __m256i shiftAC = _mm256_set1_epi32(0x04000040);
+    const __m256i maskBD = _mm256_set1_epi32(0x003f03f0);
+    const __m256i shiftBD = _mm256_set1_epi32(0x01000010);
+    const __m256i last = _mm256_set1_epi8(SPIDER_CIPHER_CARDS-1);
+    __m256i over = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i+48 <= n; i += 32) {
+      const uint8_t *p = packed+i/4*3;
+      __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*) p)),
+					  _mm_loadu_si128((const __m128i*)(p+12)),1);
+      v = _mm256_shuffle_epi8(v,spread);
+      v = _mm256_or_si256(_mm256_mulhi_epu16(_mm256_and_si256(v,maskAC),shiftAC),
+			  _mm256_mullo_epi16(_mm256_and_si256(v,maskBD),shiftBD));
+      over = _mm256_or_si256(over,_mm256_cmpgt_epi8(v,last));
+      _mm256_storeu_si256((__m256i*)(cards+i),v);
+    }
+    *bad |= _mm256_movemask_epi8(over) != 0;
+    return i;
+  }
+
+#endif
+
+  size_t SpiderCipherPack(const SpiderCipherCard *cards,
+			  uint8_t *packed,
+			  size_t n) {
+    size_t i = 0;
+#if SPIDER_CIPHER_PACKED_X86
+    int engine = SpiderCipherEngine();
+    if (engine == SPIDER_CIPHER_ENGINE_AVX2) {
+      i = SpiderCipherPackAVX2(cards,packed,n);
+    } else if (engine == SPIDER_CIPHER_ENGINE_SSE41) {
+      i = SpiderCipherPackSSSE3(cards,packed,n);
+    }
+#endif
+    SpiderCipherPackScalar(cards+i,packed+i/4*3,(n-i)/4);
+    i = n/4*4;
+
+    // last partial group, only the bytes it needs.
+    if (i < n) {
+      SpiderCipherCard tail[4] = { 0, 0, 0, 0 };
+      uint8_t bytes[3];
+      memcpy(tail,cards+i,n-i);
+      SpiderCipherPackScalar(tail,bytes,1);
+      memcpy(packed+i/4*3,bytes,SPIDER_CIPHER_PACKED_BYTES(n)-i/4*3);
+    }
+    return SPIDER_CIPHER_PACKED_BYTES(n);
+  }
+
+  int SpiderCipherUnpack(const uint8_t *packed,
+			 SpiderCipherCard *cards,
+			 size_t n) {
+    uint8_t bad = 0;
+    size_t i = 0;
+#if SPIDER_CIPHER_PACKED_X86
+    int engine = SpiderCipherEngine();
+    if (engine == SPIDER_CIPHER_ENGINE_AVX2) {
+      i = SpiderCipherUnpackAVX2(packed,cards,n,&bad);
+    } else if (engine == SPIDER_CIPHER_ENGINE_SSE41) {
+      i = SpiderCipherUnpackSSSE3(packed,cards,n,&bad);
+    }
+#endif
+    bad |= SpiderCipherUnpackScalar(packed+i/4*3,cards+i,(n-i)/4);
+    i = n/4*4;
+
+    if (i < n) {
+      uint8_t bytes[3] = { 0, 0, 0 };
+      SpiderCipherCard tail[4];
+      memcpy(bytes,packed+i/4*3,SPIDER_CIPHER_PACKED_BYTES(n)-i/4*3);
+      SpiderCipherUnpackScalar(bytes,tail,1);
+      for (size_t t=0; t<n-i; ++t) {
+	bad |= tail[t] >= SPIDER_CIPHER_CARDS;
+      }
+      memcpy(cards+i,tail,n-i);
+    }
+    return !bad;
+  }
+
+  // chunks up to the first with a card of 40..63 (not done).
+  static int SpiderCipherPackedBuffer(SpiderCipherDeck *deck,
+				      const uint8_t *in,
+				      uint8_t *out,
+				      size_t n,
+				      int unscramble) {
+    SpiderCipherCard cards[SPIDER_CIPHER_PACKED_CHUNK];
+    int ok = 1;
+    for (size_t at=0; ok && at<n; at += SPIDER_CIPHER_PACKED_CHUNK) {
+      size_t k = n-at < SPIDER_CIPHER_PACKED_CHUNK ? n-at : SPIDER_CIPHER_PACKED_CHUNK;
+      size_t byte = at/4*3;
+      ok = SpiderCipherUnpack(in+byte,cards,k);
+      if (!ok) break;
+      if (unscramble) {
+	SpiderCipherUnscrambleBuffer(deck,cards,cards,k);
+      } else {
+	SpiderCipherScrambleBuffer(deck,cards,cards,k);
+      }
+      SpiderCipherPack(cards,out+byte,k);
+    }
+    memset(cards,0,sizeof(cards));
+    return ok;
+  }
+
+  int SpiderCipherScramblePacked(SpiderCipherDeck *deck,
+				 const uint8_t *in,
+				 uint8_t *out,
+				 size_t n) {
+    return SpiderCipherPackedBuffer(deck,in,out,n,0);
+  }
+
+  int SpiderCipherUnscramblePacked(SpiderCipherDeck *deck,
+				   const uint8_t *in,
+				   uint8_t *out,
+				   size_t n) {
+    return SpiderCipherPackedBuffer(deck,in,out,n,1);
+  }
+
+#ifdef __cplusplus
+}
+#endif
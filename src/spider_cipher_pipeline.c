@@ -0,0 +1,304 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "spider_cipher_pipeline.h"
+
+#define SPIDER_CIPHER_CACHE_LINE 64
+#define SPIDER_CIPHER_QUEUE_MIN 64
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  //
+  // Ring of job pointers: the owner pushes and pops at the tail,
+  // thieves take from the head.  size is a power of 2 and
+  // tail-head jobs are queued.
+  //
+  typedef struct {
+    SpiderCipherPipelineJob **jobs;
+    size_t size;
+    size_t head;
+    size_t tail;
+  } SpiderCipherPipelineRing;
+
+  //
+  // One per worker, each on its own cache lines so the workers
+  // only share when they steal.
+  //
+  typedef struct {
+    _Alignas(SPIDER_CIPHER_CACHE_LINE) pthread_mutex_t lock;
+    SpiderCipherPipelineRing queue;
+    SpiderCipherPipeline *pipeline;
+    pthread_t thread;
+    int index;
+  } SpiderCipherPipelineWorker;
+
+  struct SpiderCipherPipeline {
+    int threads;
+    SpiderCipherPipelineWorker *workers;
+
+    // jobs sitting in worker queues (taken under the queue lock)
+    _Alignas(SPIDER_CIPHER_CACHE_LINE) atomic_size_t queued;
+
+    // everything else is under lock
+    _Alignas(SPIDER_CIPHER_CACHE_LINE) pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t done;
+    SpiderCipherPipelineRing completed;
+    size_t outstanding;
+    int next;
+    int stopping;
+  };
+
+  static int SpiderCipherPipelineRingReserve(SpiderCipherPipelineRing *ring,
+					     size_t count) {
+    size_t used = ring->tail-ring->head;
+    if (used+count <= ring->size) return 1;
+    size_t size = ring->size ? ring->size : SPIDER_CIPHER_QUEUE_MIN;
+    while (size < used+count) size *= 2;
+    SpiderCipherPipelineJob **jobs =
+      (SpiderCipherPipelineJob**) malloc(size*sizeof(SpiderCipherPipelineJob*));
+    if (jobs == NULL) return 0;
+    for (size_t i=0; i<used; ++i) {
+      jobs[i]=ring->jobs[(ring->head+i) & (ring->size-1)];
+    }
+    free(ring->jobs);
+    ring->jobs=jobs;
+    ring->size=size;
+    ring->head=0;
+    ring->tail=used;
+    return 1;
+  }
+
+  // caller must have reserved room.
+  static void SpiderCipherPipelineRingPush(SpiderCipherPipelineRing *ring,
+					   SpiderCipherPipelineJob *job) {
+    ring->jobs[ring->tail & (ring->size-1)]=job;
+    ++ring->tail;
+  }
+
+  static SpiderCipherPipelineJob *SpiderCipherPipelineRingPopTail(SpiderCipherPipelineRing *ring) {
+    if (ring->tail == ring->head) return NULL;
+    --ring->tail;
+    return ring->jobs[ring->tail & (ring->size-1)];
+  }
+
+  static SpiderCipherPipelineJob *SpiderCipherPipelineRingPopHead(SpiderCipherPipelineRing *ring) {
+    if (ring->tail == ring->head) return NULL;
+    SpiderCipherPipelineJob *job = ring->jobs[ring->head & (ring->size-1)];
+    ++ring->head;
+    return job;
+  }
+
+  // own queue first (newest job, still warm), then steal the oldest
+  // job of the next busy worker.
+  static SpiderCipherPipelineJob *SpiderCipherPipelineTake(SpiderCipherPipelineWorker *worker) {
+    SpiderCipherPipeline *pipeline = worker->pipeline;
+    SpiderCipherPipelineJob *job;
+
+    pthread_mutex_lock(&worker->lock);
+    job = SpiderCipherPipelineRingPopTail(&worker->queue);
+    if (job != NULL) atomic_fetch_sub(&pipeline->queued,1);
+    pthread_mutex_unlock(&worker->lock);
+    if (job != NULL) return job;
+
+    for (int i=1; i<pipeline->threads; ++i) {
+      if (atomic_load(&pipeline->queued) == 0) break;
+      SpiderCipherPipelineWorker *victim =
+	&pipeline->workers[(worker->index+i) % pipeline->threads];
+      pthread_mutex_lock(&victim->lock);
+      job = SpiderCipherPipelineRingPopHead(&victim->queue);
+      if (job != NULL) atomic_fetch_sub(&pipeline->queued,1);
+      pthread_mutex_unlock(&victim->lock);
+      if (job != NULL) return job;
+    }
+    return NULL;
+  }
+
+  static void SpiderCipherPipelineRun(SpiderCipherPipelineJob *job) {
+    SpiderCipherDeck deck;
+    job->ok = SpiderCipherDeckInitBy(&deck,job->key,job->misc);
+    if (job->ok) {
+      if (job->unscramble) {
+	SpiderCipherUnscrambleBuffer(&deck,job->in,job->out,job->n);
+      } else {
+	SpiderCipherScrambleBuffer(&deck,job->in,job->out,job->n);
+      }
+    }
+    SpiderCipherDeckInit(&deck);
+  }
+
+  static void *SpiderCipherPipelineWork(void *arg) {
+    SpiderCipherPipelineWorker *worker = (SpiderCipherPipelineWorker*) arg;
+    SpiderCipherPipeline *pipeline = worker->pipeline;
+
+    for (;;) {
+      SpiderCipherPipelineJob *job = SpiderCipherPipelineTake(worker);
+      if (job != NULL) {
+	SpiderCipherPipelineRun(job);
+	pthread_mutex_lock(&pipeline->lock);
+	SpiderCipherPipelineRingPush(&pipeline->completed,job);
+	pthread_cond_signal(&pipeline->done);
+	pthread_mutex_unlock(&pipeline->lock);
+	continue;
+      }
+
+      pthread_mutex_lock(&pipeline->lock);
+      while (atomic_load(&pipeline->queued) == 0 && !pipeline->stopping) {
+	pthread_cond_wait(&pipeline->work,&pipeline->lock);
+      }
+      int stop = pipeline->stopping && atomic_load(&pipeline->queued) == 0;
+      pthread_mutex_unlock(&pipeline->lock);
+      if (stop) break;
+    }
+    return NULL;
+  }
+
+  // stop and join the first started workers, then free everything.
+  static void SpiderCipherPipelineStop(SpiderCipherPipeline *pipeline,
+				       int started) {
+    pthread_mutex_lock(&pipeline->lock);
+    pipeline->stopping = 1;
+    pthread_cond_broadcast(&pipeline->work);
+    pthread_mutex_unlock(&pipeline->lock);
+
+    for (int i=0; i<started; ++i) {
+      pthread_join(pipeline->workers[i].thread,NULL);
+    }
+    for (int i=0; i<pipeline->threads; ++i) {
+      SpiderCipherPipelineWorker *worker = &pipeline->workers[i];
+      pthread_mutex_destroy(&worker->lock);
+      free(worker->queue.jobs);
+    }
+    pthread_cond_destroy(&pipeline->done);
+    pthread_cond_destroy(&pipeline->work);
+    pthread_mutex_destroy(&pipeline->lock);
+    free(pipeline->completed.jobs);
+    free(pipeline->workers);
+    free(pipeline);
+  }
+
+  SpiderCipherPipeline *SpiderCipherPipelineNew(int threads) {
+    if (threads <= 0) {
+      long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+      threads = cpus > 0 ? (int) cpus : 1;
+    }
+
+    SpiderCipherPipeline *pipeline = (SpiderCipherPipeline*)
+      aligned_alloc(SPIDER_CIPHER_CACHE_LINE,sizeof(SpiderCipherPipeline));
+    if (pipeline == NULL) return NULL;
+    memset(pipeline,0,sizeof(SpiderCipherPipeline));
+    pipeline->workers = (SpiderCipherPipelineWorker*)
+      aligned_alloc(SPIDER_CIPHER_CACHE_LINE,threads*sizeof(SpiderCipherPipelineWorker));
+    if (pipeline->workers == NULL) {
+      free(pipeline);
+      return NULL;
+    }
+    memset(pipeline->workers,0,threads*sizeof(SpiderCipherPipelineWorker));
+    atomic_init(&pipeline->queued,0);
+    pthread_mutex_init(&pipeline->lock,NULL);
+    pthread_cond_init(&pipeline->work,NULL);
+    pthread_cond_init(&pipeline->done,NULL);
+
+    // pick the engine before any worker races to do it.
+    SpiderCipherEngine();
+
+    // every worker must be in place before any of them steals.
+    pipeline->threads = threads;
+    for (int i=0; i<threads; ++i) {
+      SpiderCipherPipelineWorker *worker = &pipeline->workers[i];
+      pthread_mutex_init(&worker->lock,NULL);
+      worker->pipeline = pipeline;
+      worker->index = i;
+    }
+    for (int i=0; i<threads; ++i) {
+      SpiderCipherPipelineWorker *worker = &pipeline->workers[i];
+      if (pthread_create(&worker->thread,NULL,SpiderCipherPipelineWork,worker) != 0) {
+	SpiderCipherPipelineStop(pipeline,i);
+	return NULL;
+      }
+    }
+    return pipeline;
+  }
+
+  int SpiderCipherPipelineThreads(SpiderCipherPipeline *pipeline) {
+    return pipeline->threads;
+  }
+
+  int SpiderCipherPipelineSubmit(SpiderCipherPipeline *pipeline,
+				 SpiderCipherPipelineJob *jobs,
+				 size_t count) {
+    int threads = pipeline->threads;
+    size_t share = count/threads, extra = count%threads;
+    int ok = 1;
+
+    if (count == 0) return 1;
+    pthread_mutex_lock(&pipeline->lock);
+
+    // every submitted job must fit in the completion queue, so the
+    // workers never allocate.
+    size_t running = pipeline->outstanding -
+      (pipeline->completed.tail-pipeline->completed.head);
+    ok = SpiderCipherPipelineRingReserve(&pipeline->completed,running+count);
+    for (int i=0; ok && i<threads; ++i) {
+      SpiderCipherPipelineWorker *worker = &pipeline->workers[i];
+      pthread_mutex_lock(&worker->lock);
+      ok = SpiderCipherPipelineRingReserve(&worker->queue,share+(extra > 0));
+      pthread_mutex_unlock(&worker->lock);
+    }
+
+    if (ok) {
+      // counted before they are visible, so takers never see queued
+      // drop below zero.
+      atomic_fetch_add(&pipeline->queued,count);
+      size_t at = 0;
+      for (int i=0; i<threads; ++i) {
+	int w = (pipeline->next+i) % threads;
+	size_t k = share + ((size_t) i < extra);
+	SpiderCipherPipelineWorker *worker = &pipeline->workers[w];
+	pthread_mutex_lock(&worker->lock);
+	for (size_t j=0; j<k; ++j) {
+	  SpiderCipherPipelineRingPush(&worker->queue,&jobs[at++]);
+	}
+	pthread_mutex_unlock(&worker->lock);
+      }
+      pipeline->next = (pipeline->next+extra) % threads;
+      pipeline->outstanding += count;
+      pthread_cond_broadcast(&pipeline->work);
+    }
+
+    pthread_mutex_unlock(&pipeline->lock);
+    return ok;
+  }
+
+  size_t SpiderCipherPipelineComplete(SpiderCipherPipeline *pipeline,
+				      SpiderCipherPipelineJob **done,
+				      size_t max) {
+    size_t k = 0;
+    pthread_mutex_lock(&pipeline->lock);
+    while (pipeline->outstanding > 0 &&
+	   pipeline->completed.tail == pipeline->completed.head) {
+      pthread_cond_wait(&pipeline->done,&pipeline->lock);
+    }
+    while (k < max) {
+      SpiderCipherPipelineJob *job = SpiderCipherPipelineRingPopHead(&pipeline->completed);
+      if (job == NULL) break;
+      done[k++]=job;
+    }
+    pipeline->outstanding -= k;
+    pthread_mutex_unlock(&pipeline->lock);
+    return k;
+  }
+
+  void SpiderCipherPipelineFree(SpiderCipherPipeline *pipeline) {
+    if (pipeline == NULL) return;
+    SpiderCipherPipelineStop(pipeline,pipeline->threads);
+  }
+
+#ifdef __cplusplus
+}
+#endif
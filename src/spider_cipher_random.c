@@ -0,0 +1,232 @@
+#include <errno.h>
+#include <string.h>
+#include <sys/random.h>
+
+#include "spider_cipher_random.h"
+#include "spider_cipher_internal.h"
+
+// 39 Fisher-Yates picks (0..39-i) then 40 round picks (0..39).
+#define SPIDER_CIPHER_SHUFFLE_PICKS (SPIDER_CIPHER_CARDS-1)
+#define SPIDER_CIPHER_PICKS (SPIDER_CIPHER_SHUFFLE_PICKS+SPIDER_CIPHER_CARDS)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  //
+  // The mix works on cards only (half the bytes of a deck), finding
+  // the few positions it needs with memchr, and rebuilds the deck's
+  // ats at the end.
+  //
+
+  static uint8_t SpiderCipherFind(const SpiderCipherCard *cards,
+				  SpiderCipherCard card) {
+    return (uint8_t) ((const SpiderCipherCard*) memchr(cards,card,SPIDER_CIPHER_CARDS)-cards);
+  }
+
+  // cut so card is on top, then back-front shuffle, as one pass.
+  static void SpiderCipherCutShuffle(const SpiderCipherCard *input,
+				     SpiderCipherCard card,
+				     SpiderCipherCard *output) {
+    uint8_t cutAt = SpiderCipherFind(input,card);
+    uint8_t at;
+    for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+      at = SPIDER_CIPHER_BACK_FRONT[i]+cutAt;
+      if (at >= SPIDER_CIPHER_CARDS) at -= SPIDER_CIPHER_CARDS;
+      output[i]=input[at];
+    }
+    cutAt = at = 0;
+  }
+
+  static SpiderCipherCard SpiderCipherCutCard(const SpiderCipherCard *cards,
+					      SpiderCipherCard card) {
+    return (card+cards[SPIDER_CIPHER_CUT_ZTH]) % SPIDER_CIPHER_CARDS;
+  }
+
+  static SpiderCipherCard SpiderCipherNoiseCard(const SpiderCipherCard *cards) {
+    SpiderCipherCard tag =
+      (cards[SPIDER_CIPHER_TAG_ZTH]+SPIDER_CIPHER_TAG_ADD) % SPIDER_CIPHER_CARDS;
+    return cards[(SpiderCipherFind(cards,tag)+1) % SPIDER_CIPHER_CARDS];
+  }
+
+  //
+  // picks[i] is 0..39-i for the shuffle, then 0..39 for the rounds.
+  //
+  static void SpiderCipherMix(SpiderCipherDeck *deck,
+			      const uint8_t picks[SPIDER_CIPHER_PICKS]) {
+    // pools and decks take turns as input and output.
+    SpiderCipherCard pools[2][SPIDER_CIPHER_CARDS],decks[2][SPIDER_CIPHER_CARDS];
+    SpiderCipherCard *pool = pools[0], *deckNow = decks[0];
+    SpiderCipherCard card;
+
+    for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+      pool[i]=i;
+    }
+    for (uint8_t i=0; i<SPIDER_CIPHER_SHUFFLE_PICKS; ++i) {
+      card = pool[i];
+      pool[i]=pool[i+picks[i]];
+      pool[i+picks[i]]=card;
+    }
+    memcpy(deckNow,deck->cards,SPIDER_CIPHER_CARDS);
+
+    for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+      SpiderCipherCard *next = pools[(i+1)&1];
+      card = SpiderCipherCutCard(pool,picks[SPIDER_CIPHER_SHUFFLE_PICKS+i]);
+      SpiderCipherCutShuffle(pool,card,next);
+      pool = next;
+
+      next = decks[(i+1)&1];
+      card = SpiderCipherCutCard(deckNow,SpiderCipherNoiseCard(pool));
+      SpiderCipherCutShuffle(deckNow,card,next);
+      deckNow = next;
+    }
+    SpiderCipherDeckInitFromArray(deck,deckNow);
+
+    memset(pools,0,sizeof(pools));
+    memset(decks,0,sizeof(decks));
+    card = 0;
+  }
+
+  void SpiderCipherEntropyInit(SpiderCipherEntropy *entropy) {
+    memset(entropy,0,sizeof(SpiderCipherEntropy));
+  }
+
+  void SpiderCipherEntropyInitBuffer(SpiderCipherEntropy *entropy,
+				     const uint8_t *bytes,
+				     size_t size) {
+    memset(entropy,0,sizeof(SpiderCipherEntropy));
+    entropy->buffer = bytes;
+    entropy->bufferSize = size;
+  }
+
+  void SpiderCipherEntropyFinish(SpiderCipherEntropy *entropy) {
+    memset(entropy,0,sizeof(SpiderCipherEntropy));
+  }
+
+  // refill the pool, 0 - no more entropy.
+  static int SpiderCipherEntropyFill(SpiderCipherEntropy *entropy) {
+    if (entropy->buffer != NULL) {
+      // the caller's bytes are the pool.
+      return 0;
+    }
+    size_t size = 0;
+    while (size < SPIDER_CIPHER_ENTROPY_POOL) {
+      ssize_t got = getrandom(entropy->pool+size,SPIDER_CIPHER_ENTROPY_POOL-size,0);
+      if (got < 0) {
+	if (errno == EINTR) continue;
+	break;
+      }
+      size += got;
+    }
+    entropy->at = 0;
+    entropy->size = size;
+    return size > 0;
+  }
+
+  //
+  // The next picks for one deck, one byte each: a byte of
+  // 256-256%n or more is dropped, so every pick is unbiased.
+  //
+  static int SpiderCipherEntropyPicks(SpiderCipherEntropy *entropy,
+				      uint8_t picks[SPIDER_CIPHER_PICKS]) {
+    const uint8_t *bytes;
+    size_t at,size;
+    if (entropy->buffer != NULL) {
+      bytes = entropy->buffer;
+      size = entropy->bufferSize;
+    } else {
+      bytes = entropy->pool;
+      size = entropy->size;
+    }
+    at = entropy->at;
+
+    for (int i=0; i<SPIDER_CIPHER_PICKS; ++i) {
+      unsigned n = i < SPIDER_CIPHER_SHUFFLE_PICKS ? SPIDER_CIPHER_CARDS-i : SPIDER_CIPHER_CARDS;
+      unsigned limit = 256-256%n;
+      for (;;) {
+	if (at == size) {
+	  entropy->at = at;
+	  if (!SpiderCipherEntropyFill(entropy)) return 0;
+	  at = 0;
+	  size = entropy->size;
+	}
+	unsigned byte = bytes[at];
+	// a pool byte is wiped once used.
+	if (bytes == entropy->pool) entropy->pool[at] = 0;
+	++at;
+	if (byte < limit) {
+	  picks[i] = byte % n;
+	  break;
+	}
+      }
+    }
+    entropy->at = at;
+    return 1;
+  }
+
+  size_t SpiderCipherRandomizeDecks(SpiderCipherDeck *decks,
+				    size_t count,
+				    SpiderCipherEntropy *entropy) {
+    uint8_t picks[SPIDER_CIPHER_PICKS];
+    size_t done = 0;
+    for (; done<count; ++done) {
+      if (!SpiderCipherEntropyPicks(entropy,picks)) {
+	SpiderCipherDeckInit(&decks[done]);
+	break;
+      }
+      SpiderCipherMix(&decks[done],picks);
+    }
+    memset(picks,0,sizeof(picks));
+    return done;
+  }
+
+  int SpiderCipherRandomize(SpiderCipherDeck *deck,
+			    int64_t (*rand)(void *misc),
+			    void *misc,
+			    int64_t randMax) {
+    uint8_t picks[SPIDER_CIPHER_PICKS];
+    uint64_t q,qMax,r,rMax;
+    int nr,ok = 1;
+
+    if (randMax < 1) {
+      SpiderCipherDeckInit(deck);
+      return 0;
+    }
+
+    // nr values make a q of 0..qMax-1 with qMax at least 40*40, so
+    // rejection drops little.
+    rMax = (uint64_t) randMax+1;
+    qMax = 1;
+    nr = 0;
+    while (qMax < SPIDER_CIPHER_CARDS*SPIDER_CIPHER_CARDS) {
+      qMax *= rMax;
+      ++nr;
+    }
+
+    for (int i=0; ok && i<SPIDER_CIPHER_PICKS; ++i) {
+      unsigned n = i < SPIDER_CIPHER_SHUFFLE_PICKS ? SPIDER_CIPHER_CARDS-i : SPIDER_CIPHER_CARDS;
+      do {
+	q = 0;
+	for (int j=0; ok && j<nr; ++j) {
+	  int64_t value = rand(misc);
+	  if (value < 0 || value > randMax) ok = 0;
+	  r = (uint64_t) value;
+	  q = rMax*q + r;
+	}
+      } while (ok && q >= qMax-qMax%n);
+      picks[i] = q % n;
+    }
+
+    if (ok) {
+      SpiderCipherMix(deck,picks);
+    } else {
+      SpiderCipherDeckInit(deck);
+    }
+    memset(picks,0,sizeof(picks));
+    q = qMax = r = rMax = 0;
+    return ok;
+  }
+
+#ifdef __cplusplus
+}
+#endif
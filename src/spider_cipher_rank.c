@@ -0,0 +1,170 @@
+#include <string.h>
+
+#include "spider_cipher_rank.h"
+
+// 32 bit words of a rank, least significant first.
+#define SPIDER_CIPHER_RANK_WORDS (SPIDER_CIPHER_RANK_BYTES/4)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  //
+  // Digits are taken in groups whose radix product fits in 32 bits:
+  // group g is digits GROUPS[g]..GROUPS[g+1]-1 with radix RADICES[g],
+  // and digit i weighs SUFFIXES[i] in the group value.
+  //
+#define SPIDER_CIPHER_RANK_GROUPS 6
+
+  static const uint8_t SPIDER_CIPHER_RANK_GROUP[SPIDER_CIPHER_RANK_GROUPS+1] =
+    { 0, 6, 12, 18, 25, 34, 40 };
+
+  static const uint32_t SPIDER_CIPHER_RANK_RADICES[SPIDER_CIPHER_RANK_GROUPS] =
+    { 2763633600u, 968330880u, 271252800u, 859541760u, 1816214400u, 720u };
+
+  static const uint32_t SPIDER_CIPHER_RANK_SUFFIXES[SPIDER_CIPHER_CARDS] =
+    {
+     69090840, 1771560, 46620, 1260, 35, 1,
+     28480320, 863040, 26970, 870, 29, 1,
+     9687600, 358800, 13800, 552, 23, 1,
+     39070080, 1860480, 93024, 4896, 272, 16, 1,
+     121080960, 8648640, 665280, 55440, 5040, 504, 56, 7, 1,
+     120, 24, 6, 2, 1, 1
+    };
+
+  static uint8_t SpiderCipherRankCount(uint64_t bits) {
+#if defined(__POPCNT__)
+    return (uint8_t) __builtin_popcountll(bits);
+#else
+    bits = bits - ((bits >> 1) & 0x5555555555555555ull);
+    bits = (bits & 0x3333333333333333ull) + ((bits >> 2) & 0x3333333333333333ull);
+    bits = (bits + (bits >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return (uint8_t) ((bits * 0x0101010101010101ull) >> 56);
+#endif
+  }
+
+  // the cards (bits) before card.
+  static uint64_t SpiderCipherRankBelow(SpiderCipherCard card) {
+    return (((uint64_t) 1) << card)-1;
+  }
+
+  void SpiderCipherRank(const SpiderCipherDeck *deck,
+			uint8_t rank[SPIDER_CIPHER_RANK_BYTES]) {
+    uint8_t digits[SPIDER_CIPHER_CARDS];
+    uint32_t words[SPIDER_CIPHER_RANK_WORDS] = { 0 };
+    uint64_t used = 0;
+
+    // digit i = cards after i that are smaller = card - used smaller.
+    for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+      SpiderCipherCard card = deck->cards[i];
+      digits[i] = card - SpiderCipherRankCount(used & SpiderCipherRankBelow(card));
+      used |= ((uint64_t) 1) << card;
+    }
+
+    for (int g=0; g<SPIDER_CIPHER_RANK_GROUPS; ++g) {
+      uint64_t value = 0;
+      for (uint8_t i=SPIDER_CIPHER_RANK_GROUP[g]; i<SPIDER_CIPHER_RANK_GROUP[g+1]; ++i) {
+	value += (uint64_t) digits[i]*SPIDER_CIPHER_RANK_SUFFIXES[i];
+      }
+      // words = words*radix + value.
+      for (int w=0; w<SPIDER_CIPHER_RANK_WORDS; ++w) {
+	value += (uint64_t) words[w]*SPIDER_CIPHER_RANK_RADICES[g];
+	words[w] = (uint32_t) value;
+	value >>= 32;
+      }
+    }
+
+    for (int w=0; w<SPIDER_CIPHER_RANK_WORDS; ++w) {
+      uint32_t word = words[SPIDER_CIPHER_RANK_WORDS-1-w];
+      rank[4*w+0] = word >> 24;
+      rank[4*w+1] = word >> 16;
+      rank[4*w+2] = word >> 8;
+      rank[4*w+3] = word;
+    }
+    memset(words,0,sizeof(words));
+    memset(digits,0,sizeof(digits));
+    used = 0;
+  }
+
+  // words = words / radix over words[0..top-1], the remainder
+  // returned.  Inlined with a constant radix (and group bounds, for
+  // the digits) the compiler turns the divisions into multiplies.
+  static inline uint32_t SpiderCipherRankDivide(uint32_t *words,
+						int top,
+						uint32_t radix) {
+    uint64_t value = 0;
+    for (int w=top-1; w>=0; --w) {
+      value = value << 32 | words[w];
+      words[w] = (uint32_t) (value / radix);
+      value %= radix;
+    }
+    return (uint32_t) value;
+  }
+
+  // digits first..end-1 of a group value, the last least significant.
+  static inline void SpiderCipherRankDigits(uint8_t *digits,
+					    uint32_t value,
+					    uint8_t first,
+					    uint8_t end) {
+    for (uint8_t i=end; i-- > first; ) {
+      digits[i] = value % (SPIDER_CIPHER_CARDS-i);
+      value /= SPIDER_CIPHER_CARDS-i;
+    }
+  }
+
+#define SPIDER_CIPHER_RANK_SPLIT(g)					\
+  while (top > 0 && words[top-1] == 0) --top;				\
+  SpiderCipherRankDigits(digits,SpiderCipherRankDivide(words,top,SPIDER_CIPHER_RANK_RADICES[g]), \
+			 SPIDER_CIPHER_RANK_GROUP[g],SPIDER_CIPHER_RANK_GROUP[g+1])
+
+  int SpiderCipherUnrank(SpiderCipherDeck *deck,
+			 const uint8_t rank[SPIDER_CIPHER_RANK_BYTES]) {
+    uint32_t words[SPIDER_CIPHER_RANK_WORDS];
+    uint8_t digits[SPIDER_CIPHER_CARDS];
+    SpiderCipherCard left[SPIDER_CIPHER_CARDS];
+    int top = SPIDER_CIPHER_RANK_WORDS;
+
+    for (int w=0; w<SPIDER_CIPHER_RANK_WORDS; ++w) {
+      const uint8_t *bytes = rank+4*(SPIDER_CIPHER_RANK_WORDS-1-w);
+      words[w] = (uint32_t) bytes[0] << 24 | (uint32_t) bytes[1] << 16
+	| (uint32_t) bytes[2] << 8 | bytes[3];
+    }
+
+    // the last group is the least significant.
+    SPIDER_CIPHER_RANK_SPLIT(5);
+    SPIDER_CIPHER_RANK_SPLIT(4);
+    SPIDER_CIPHER_RANK_SPLIT(3);
+    SPIDER_CIPHER_RANK_SPLIT(2);
+    SPIDER_CIPHER_RANK_SPLIT(1);
+    SPIDER_CIPHER_RANK_SPLIT(0);
+    // a rank under 40! is all used up.
+    while (top > 0 && words[top-1] == 0) --top;
+
+    // card i is the digit-th of the cards left (in order).
+    for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+      left[i] = i;
+    }
+    for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+      uint8_t digit = digits[i];
+      deck->cards[i] = left[digit];
+      memmove(left+digit,left+digit+1,SPIDER_CIPHER_CARDS-1-i-digit);
+    }
+
+    int ok = top == 0;
+    if (ok) {
+      for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+	deck->ats[deck->cards[i]] = i;
+      }
+    } else {
+      SpiderCipherDeckInit(deck);
+    }
+
+    memset(words,0,sizeof(words));
+    memset(digits,0,sizeof(digits));
+    memset(left,0,sizeof(left));
+    return ok;
+  }
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,152 @@
+#include <string.h>
+
+#include "spider_cipher_session.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  void SpiderCipherCheckpointLogInit(SpiderCipherCheckpointLog *log,
+				     SpiderCipherCheckpoint *checkpoints,
+				     size_t capacity,
+				     uint64_t interval) {
+    log->checkpoints = checkpoints;
+    log->capacity = capacity;
+    log->count = 0;
+    log->interval = interval ? interval : 1;
+  }
+
+  // keep checkpoints 0,2,4,... at twice the interval.
+  static void SpiderCipherCheckpointLogThin(SpiderCipherCheckpointLog *log) {
+    size_t count = (log->count+1)/2;
+    for (size_t i=1; i<count; ++i) {
+      log->checkpoints[i]=log->checkpoints[2*i];
+    }
+    memset(log->checkpoints+count,0,(log->count-count)*sizeof(SpiderCipherCheckpoint));
+    log->count = count;
+    log->interval *= 2;
+  }
+
+  // checkpoint the deck if the session is at a new interval.
+  static void SpiderCipherSessionRecord(SpiderCipherSession *session) {
+    SpiderCipherCheckpointLog *log = session->log;
+    if (session->cards % log->interval != 0) return;
+    if (session->cards/log->interval < log->count) return;
+    if (log->count == log->capacity) {
+      SpiderCipherCheckpointLogThin(log);
+      if (session->cards % log->interval != 0) return;
+    }
+    memcpy(log->checkpoints[log->count].cards,session->deck.cards,SPIDER_CIPHER_CARDS);
+    ++log->count;
+  }
+
+  int SpiderCipherSessionInit(SpiderCipherSession *session,
+			      const SpiderCipherCard key[SPIDER_CIPHER_CARDS],
+			      int unscramble) {
+    session->ok = SpiderCipherDeckInitFromArray(&session->deck,key);
+    session->unscramble = unscramble;
+    session->cards = 0;
+    session->fed = 0;
+    session->log = NULL;
+    return session->ok;
+  }
+
+  int SpiderCipherSessionInitBy(SpiderCipherSession *session,
+				SpiderCipherCard (*f)(uint8_t at, void *misc),
+				void *misc,
+				int unscramble) {
+    SpiderCipherCard key[SPIDER_CIPHER_CARDS];
+    for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+      key[i] = f ? f(i,misc) : i;
+    }
+    int ok = SpiderCipherSessionInit(session,key,unscramble);
+    memset(key,0,sizeof(key));
+    return ok;
+  }
+
+  int SpiderCipherSessionLog(SpiderCipherSession *session,
+			     SpiderCipherCheckpointLog *log) {
+    if (!session->ok || session->cards != 0 || log->capacity == 0) return 0;
+    memset(log->checkpoints,0,log->count*sizeof(SpiderCipherCheckpoint));
+    log->count = 0;
+    session->log = log;
+    SpiderCipherSessionRecord(session);
+    return 1;
+  }
+
+  static void SpiderCipherSessionRun(SpiderCipherSession *session,
+				     const SpiderCipherCard *in,
+				     SpiderCipherCard *out,
+				     size_t n) {
+    if (session->unscramble) {
+      SpiderCipherUnscrambleBuffer(&session->deck,in,out,n);
+    } else {
+      SpiderCipherScrambleBuffer(&session->deck,in,out,n);
+    }
+    session->cards += n;
+    if (session->cards > session->fed) session->fed = session->cards;
+  }
+
+  size_t SpiderCipherSessionFeed(SpiderCipherSession *session,
+				 const SpiderCipherCard *in,
+				 SpiderCipherCard *out,
+				 size_t n) {
+    if (!session->ok) return 0;
+    if (session->log == NULL) {
+      SpiderCipherSessionRun(session,in,out,n);
+      return n;
+    }
+
+    // buffer runs up to each checkpoint.
+    size_t done = 0;
+    while (done < n) {
+      uint64_t interval = session->log->interval;
+      uint64_t left = interval - session->cards % interval;
+      size_t k = n-done < left ? n-done : (size_t) left;
+      SpiderCipherSessionRun(session,in+done,out+done,k);
+      SpiderCipherSessionRecord(session);
+      done += k;
+    }
+    return n;
+  }
+
+  int SpiderCipherSeek(SpiderCipherSession *session,
+		       uint64_t offset,
+		       const SpiderCipherCard *message) {
+    SpiderCipherCheckpointLog *log = session->log;
+    if (!session->ok || log == NULL || offset > session->fed) return 0;
+    uint64_t index = offset/log->interval;
+    if (index >= log->count) return 0;
+
+    SpiderCipherDeck deck,spare;
+    SpiderCipherDeckInitFromArray(&deck,log->checkpoints[index].cards);
+    SpiderCipherDeckInit(&spare);
+    for (uint64_t at=index*log->interval; at<offset; ++at) {
+      SpiderCipherCard clear = message[at];
+      if (session->unscramble) clear = SpiderCipherUnscramble(&deck,clear);
+      SpiderCipherAdvanceDeck(&deck,clear,&spare);
+    }
+    memcpy(&session->deck,&deck,sizeof(SpiderCipherDeck));
+    session->cards = offset;
+    SpiderCipherDeckInit(&deck);
+    SpiderCipherDeckInit(&spare);
+    return 1;
+  }
+
+  void SpiderCipherSessionFinish(SpiderCipherSession *session) {
+    SpiderCipherCheckpointLog *log = session->log;
+    if (log != NULL) {
+      memset(log->checkpoints,0,log->count*sizeof(SpiderCipherCheckpoint));
+      log->count = 0;
+    }
+    session->log = NULL;
+    SpiderCipherDeckInit(&session->deck);
+    session->cards = 0;
+    session->fed = 0;
+    session->unscramble = 0;
+    session->ok = 0;
+  }
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,390 @@
+#include "spider_cipher_simd.h"
+
+//
+// SSE4.1 and AVX2 deck permutation engines.
+//
+// A deck's 40 cards (or 40 ats) are held in overlapping windows,
+// three 16 byte windows at 0, 16 and 24 for SSE, or two 32 byte
+// windows at 0 and 8 for AVX2.  Overlapping bytes always hold the
+// same value, so loads, stores and merges never need masks.
+//
+// Any permutation out[i] = in[idx[i]] is then a pshufb of each of
+// the three 16 byte input windows, keeping only the lanes whose
+// idx falls inside that window.  Cuts use a precomputed rotation
+// of 0..39, the shuffle precomputed BACK_FRONT masks, and the
+// ats are looked up in BACK_FRONT_ATS the same way.
+//
+// The functions are compiled with target attributes, so the rest
+// of the build needs no -msse4.1 or -mavx2, and only run when
+// cpuid says they can.
+//
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SPIDER_CIPHER_X86 1
+#else
+#define SPIDER_CIPHER_X86 0
+#endif
+
+#if SPIDER_CIPHER_X86
+#include <immintrin.h>
+
+#define SPIDER_CIPHER_SSE41 __attribute__((target("ssse3,sse4.1")))
+#define SPIDER_CIPHER_AVX2 __attribute__((target("avx2")))
+#define SPIDER_CIPHER_INLINE static inline __attribute__((always_inline))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if SPIDER_CIPHER_X86
+
+  //
+  // IDS[cutAt+i] = (cutAt+i) % 40, BACK_FRONTS[cutAt+i] =
+  // BACK_FRONT[(cutAt+i) % 40], so an unaligned load at cutAt is
+  // the rotated index vector.
+  //
+  static const uint8_t SPIDER_CIPHER_IDS[96] __attribute__((aligned(32))) =
+    {
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15,16,17,18,19,
+     20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15,16,17,18,19,
+     20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39
+    };
+
+  static const uint8_t SPIDER_CIPHER_BACK_FRONTS[96] __attribute__((aligned(32))) =
+    {
+     39,37,35,33,31,29,27,25,23,21,19,17,15,13,11, 9, 7, 5, 3, 1,
+      0, 2, 4, 6, 8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,
+     39,37,35,33,31,29,27,25,23,21,19,17,15,13,11, 9, 7, 5, 3, 1,
+      0, 2, 4, 6, 8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38
+    };
+
+  static const uint8_t SPIDER_CIPHER_BACK_FRONT_ATS[48] __attribute__((aligned(16))) =
+    {
+     20,19,21,18,22,17,23,16,24,15,25,14,26,13,27,12,28,11,29,10,
+     30, 9,31, 8,32, 7,33, 6,34, 5,35, 4,36, 3,37, 2,38, 1,39, 0
+    };
+
+  //
+  // SSE4.1
+  //
+
+  SPIDER_CIPHER_SSE41 SPIDER_CIPHER_INLINE
+  void SpiderCipherLoadSSE41(const uint8_t *p, __m128i w[3]) {
+    w[0] = _mm_loadu_si128((const __m128i*)(p+0));
+    w[1] = _mm_loadu_si128((const __m128i*)(p+16));
+    w[2] = _mm_loadu_si128((const __m128i*)(p+24));
+  }
+
+  SPIDER_CIPHER_SSE41 SPIDER_CIPHER_INLINE
+  void SpiderCipherStoreSSE41(uint8_t *p, const __m128i w[3]) {
+    _mm_storeu_si128((__m128i*)(p+0),w[0]);
+    _mm_storeu_si128((__m128i*)(p+16),w[1]);
+    _mm_storeu_si128((__m128i*)(p+24),w[2]);
+  }
+
+  // v % 40 for v in 0..79
+  SPIDER_CIPHER_SSE41 SPIDER_CIPHER_INLINE
+  __m128i SpiderCipherMod40SSE41(__m128i v) {
+    return _mm_min_epu8(v,_mm_sub_epi8(v,_mm_set1_epi8(SPIDER_CIPHER_CARDS)));
+  }
+
+  // in[idx] for idx in 0..39
+  SPIDER_CIPHER_SSE41 SPIDER_CIPHER_INLINE
+  __m128i SpiderCipherLookupSSE41(const __m128i in[3], __m128i idx) {
+    const __m128i fifteen = _mm_set1_epi8(15);
+    __m128i m0 = idx;
+    __m128i m1 = _mm_sub_epi8(idx,_mm_set1_epi8(16));
+    __m128i m2 = _mm_sub_epi8(idx,_mm_set1_epi8(24));
+    m0 = _mm_or_si128(m0,_mm_cmpgt_epi8(m0,fifteen));
+    m1 = _mm_or_si128(m1,_mm_cmpgt_epi8(m1,fifteen));
+    m2 = _mm_or_si128(m2,_mm_cmpgt_epi8(m2,fifteen));
+    return _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(in[0],m0),
+				     _mm_shuffle_epi8(in[1],m1)),
+			_mm_shuffle_epi8(in[2],m2));
+  }
+
+  SPIDER_CIPHER_SSE41
+  static void SpiderCipherCutDeckSSE41(SpiderCipherDeck *input,
+				       uint8_t cutAt,
+				       SpiderCipherDeck *output) {
+    __m128i in[3],idx[3],out[3];
+    const __m128i uncutAt = _mm_set1_epi8(SPIDER_CIPHER_CARDS-cutAt);
+
+    SpiderCipherLoadSSE41(input->cards,in);
+    SpiderCipherLoadSSE41(SPIDER_CIPHER_IDS+cutAt,idx);
+    for (int w=0; w<3; ++w) {
+      out[w] = SpiderCipherLookupSSE41(in,idx[w]);
+    }
+    SpiderCipherStoreSSE41(output->cards,out);
+
+    SpiderCipherLoadSSE41(input->ats,in);
+    for (int w=0; w<3; ++w) {
+      out[w] = SpiderCipherMod40SSE41(_mm_add_epi8(in[w],uncutAt));
+    }
+    SpiderCipherStoreSSE41(output->ats,out);
+  }
+
+  SPIDER_CIPHER_SSE41
+  static void SpiderCipherBackFrontShuffleDeckSSE41(SpiderCipherDeck *input,
+						    SpiderCipherDeck *output) {
+    __m128i in[3],table[3],out[3];
+
+    SpiderCipherLoadSSE41(input->cards,in);
+    SpiderCipherLoadSSE41(SPIDER_CIPHER_BACK_FRONTS,table);
+    for (int w=0; w<3; ++w) {
+      out[w] = SpiderCipherLookupSSE41(in,table[w]);
+    }
+    SpiderCipherStoreSSE41(output->cards,out);
+
+    SpiderCipherLoadSSE41(input->ats,in);
+    SpiderCipherLoadSSE41(SPIDER_CIPHER_BACK_FRONT_ATS,table);
+    for (int w=0; w<3; ++w) {
+      out[w] = SpiderCipherLookupSSE41(table,in[w]);
+    }
+    SpiderCipherStoreSSE41(output->ats,out);
+  }
+
+  SPIDER_CIPHER_SSE41
+  static void SpiderCipherCutShuffleCutCardsSSE41(SpiderCipherCard *input,
+						  uint8_t tagAt,
+						  uint8_t cutAt,
+						  SpiderCipherCard *output) {
+    __m128i in[3],table[3],out[3];
+    const __m128i tag = _mm_set1_epi8(tagAt);
+
+    SpiderCipherLoadSSE41(input,in);
+    SpiderCipherLoadSSE41(SPIDER_CIPHER_BACK_FRONTS+cutAt,table);
+    for (int w=0; w<3; ++w) {
+      __m128i idx = SpiderCipherMod40SSE41(_mm_add_epi8(table[w],tag));
+      out[w] = SpiderCipherLookupSSE41(in,idx);
+    }
+    SpiderCipherStoreSSE41(output,out);
+  }
+
+  SPIDER_CIPHER_SSE41
+  static void SpiderCipherCutShuffleCutDeckSSE41(SpiderCipherDeck *input,
+						 uint8_t tagAt,
+						 uint8_t cutAt,
+						 SpiderCipherDeck *output) {
+    __m128i in[3],table[3],out[3];
+    const __m128i untag = _mm_set1_epi8(SPIDER_CIPHER_CARDS-tagAt);
+    const __m128i uncut = _mm_set1_epi8(SPIDER_CIPHER_CARDS-cutAt);
+
+    SpiderCipherCutShuffleCutCardsSSE41(input->cards,tagAt,cutAt,output->cards);
+
+    SpiderCipherLoadSSE41(input->ats,in);
+    SpiderCipherLoadSSE41(SPIDER_CIPHER_BACK_FRONT_ATS,table);
+    for (int w=0; w<3; ++w) {
+      __m128i at = SpiderCipherMod40SSE41(_mm_add_epi8(in[w],untag));
+      at = SpiderCipherLookupSSE41(table,at);
+      out[w] = SpiderCipherMod40SSE41(_mm_add_epi8(at,uncut));
+    }
+    SpiderCipherStoreSSE41(output->ats,out);
+  }
+
+  // One bit per matching position, the window overlap sets
+  // the same bit twice.
+  SPIDER_CIPHER_SSE41
+  static uint8_t SpiderCipherFindCardSSE41(SpiderCipherCard *cards,
+					   SpiderCipherCard card) {
+    __m128i in[3];
+    const __m128i c = _mm_set1_epi8(card);
+
+    SpiderCipherLoadSSE41(cards,in);
+    uint64_t found =
+      ((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(in[0],c))) |
+      (((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(in[1],c))) << 16) |
+      (((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(in[2],c))) << 24);
+    return found ? (uint8_t)__builtin_ctzll(found) : SPIDER_CIPHER_CARDS;
+  }
+
+  //
+  // AVX2
+  //
+  // vpshufb only shuffles inside 128 bit lanes, so the three
+  // 16 byte input windows are broadcast to both lanes and the
+  // output is two 32 byte windows at 0 and 8.
+  //
+
+  SPIDER_CIPHER_AVX2 SPIDER_CIPHER_INLINE
+  void SpiderCipherLoadAVX2(const uint8_t *p, __m256i w[2]) {
+    w[0] = _mm256_loadu_si256((const __m256i*)(p+0));
+    w[1] = _mm256_loadu_si256((const __m256i*)(p+8));
+  }
+
+  SPIDER_CIPHER_AVX2 SPIDER_CIPHER_INLINE
+  void SpiderCipherStoreAVX2(uint8_t *p, const __m256i w[2]) {
+    _mm256_storeu_si256((__m256i*)(p+0),w[0]);
+    _mm256_storeu_si256((__m256i*)(p+8),w[1]);
+  }
+
+  SPIDER_CIPHER_AVX2 SPIDER_CIPHER_INLINE
+  void SpiderCipherBroadcastAVX2(const uint8_t *p, __m256i b[3]) {
+    b[0] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(p+0)));
+    b[1] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(p+16)));
+    b[2] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(p+24)));
+  }
+
+  SPIDER_CIPHER_AVX2 SPIDER_CIPHER_INLINE
+  __m256i SpiderCipherMod40AVX2(__m256i v) {
+    return _mm256_min_epu8(v,_mm256_sub_epi8(v,_mm256_set1_epi8(SPIDER_CIPHER_CARDS)));
+  }
+
+  SPIDER_CIPHER_AVX2 SPIDER_CIPHER_INLINE
+  __m256i SpiderCipherLookupAVX2(const __m256i in[3], __m256i idx) {
+    const __m256i fifteen = _mm256_set1_epi8(15);
+    __m256i m0 = idx;
+    __m256i m1 = _mm256_sub_epi8(idx,_mm256_set1_epi8(16));
+    __m256i m2 = _mm256_sub_epi8(idx,_mm256_set1_epi8(24));
+    m0 = _mm256_or_si256(m0,_mm256_cmpgt_epi8(m0,fifteen));
+    m1 = _mm256_or_si256(m1,_mm256_cmpgt_epi8(m1,fifteen));
+    m2 = _mm256_or_si256(m2,_mm256_cmpgt_epi8(m2,fifteen));
+    return _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(in[0],m0),
+					   _mm256_shuffle_epi8(in[1],m1)),
+			   _mm256_shuffle_epi8(in[2],m2));
+  }
+
+  SPIDER_CIPHER_AVX2
+  static void SpiderCipherCutDeckAVX2(SpiderCipherDeck *input,
+				      uint8_t cutAt,
+				      SpiderCipherDeck *output) {
+    __m256i in[3],idx[2],out[2];
+    const __m256i uncutAt = _mm256_set1_epi8(SPIDER_CIPHER_CARDS-cutAt);
+
+    SpiderCipherBroadcastAVX2(input->cards,in);
+    SpiderCipherLoadAVX2(SPIDER_CIPHER_IDS+cutAt,idx);
+    for (int w=0; w<2; ++w) {
+      out[w] = SpiderCipherLookupAVX2(in,idx[w]);
+    }
+    SpiderCipherStoreAVX2(output->cards,out);
+
+    SpiderCipherLoadAVX2(input->ats,in);
+    for (int w=0; w<2; ++w) {
+      out[w] = SpiderCipherMod40AVX2(_mm256_add_epi8(in[w],uncutAt));
+    }
+    SpiderCipherStoreAVX2(output->ats,out);
+  }
+
+  SPIDER_CIPHER_AVX2
+  static void SpiderCipherBackFrontShuffleDeckAVX2(SpiderCipherDeck *input,
+						   SpiderCipherDeck *output) {
+    __m256i in[3],table[3],idx[2],out[2];
+
+    SpiderCipherBroadcastAVX2(input->cards,in);
+    SpiderCipherLoadAVX2(SPIDER_CIPHER_BACK_FRONTS,idx);
+    for (int w=0; w<2; ++w) {
+      out[w] = SpiderCipherLookupAVX2(in,idx[w]);
+    }
+    SpiderCipherStoreAVX2(output->cards,out);
+
+    SpiderCipherBroadcastAVX2(SPIDER_CIPHER_BACK_FRONT_ATS,table);
+    SpiderCipherLoadAVX2(input->ats,idx);
+    for (int w=0; w<2; ++w) {
+      out[w] = SpiderCipherLookupAVX2(table,idx[w]);
+    }
+    SpiderCipherStoreAVX2(output->ats,out);
+  }
+
+  SPIDER_CIPHER_AVX2
+  static void SpiderCipherCutShuffleCutCardsAVX2(SpiderCipherCard *input,
+						 uint8_t tagAt,
+						 uint8_t cutAt,
+						 SpiderCipherCard *output) {
+    __m256i in[3],idx[2],out[2];
+    const __m256i tag = _mm256_set1_epi8(tagAt);
+
+    SpiderCipherBroadcastAVX2(input,in);
+    SpiderCipherLoadAVX2(SPIDER_CIPHER_BACK_FRONTS+cutAt,idx);
+    for (int w=0; w<2; ++w) {
+      __m256i at = SpiderCipherMod40AVX2(_mm256_add_epi8(idx[w],tag));
+      out[w] = SpiderCipherLookupAVX2(in,at);
+    }
+    SpiderCipherStoreAVX2(output,out);
+  }
+
+  SPIDER_CIPHER_AVX2
+  static void SpiderCipherCutShuffleCutDeckAVX2(SpiderCipherDeck *input,
+						uint8_t tagAt,
+						uint8_t cutAt,
+						SpiderCipherDeck *output) {
+    __m256i table[3],idx[2],out[2];
+    const __m256i untag = _mm256_set1_epi8(SPIDER_CIPHER_CARDS-tagAt);
+    const __m256i uncut = _mm256_set1_epi8(SPIDER_CIPHER_CARDS-cutAt);
+
+    SpiderCipherCutShuffleCutCardsAVX2(input->cards,tagAt,cutAt,output->cards);
+
+    SpiderCipherBroadcastAVX2(SPIDER_CIPHER_BACK_FRONT_ATS,table);
+    SpiderCipherLoadAVX2(input->ats,idx);
+    for (int w=0; w<2; ++w) {
+      __m256i at = SpiderCipherMod40AVX2(_mm256_add_epi8(idx[w],untag));
+      at = SpiderCipherLookupAVX2(table,at);
+      out[w] = SpiderCipherMod40AVX2(_mm256_add_epi8(at,uncut));
+    }
+    SpiderCipherStoreAVX2(output->ats,out);
+  }
+
+  SPIDER_CIPHER_AVX2
+  static uint8_t SpiderCipherFindCardAVX2(SpiderCipherCard *cards,
+					  SpiderCipherCard card) {
+    __m256i in[2];
+    const __m256i c = _mm256_set1_epi8(card);
+
+    SpiderCipherLoadAVX2(cards,in);
+    uint64_t found =
+      ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(in[0],c))) |
+      (((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(in[1],c))) << 8);
+    return found ? (uint8_t)__builtin_ctzll(found) : SPIDER_CIPHER_CARDS;
+  }
+
+  static const SpiderCipherEngineOps SPIDER_CIPHER_ENGINE_OPS_SSE41 =
+    {
+     SPIDER_CIPHER_ENGINE_SSE41,
+     "sse4.1",
+     SpiderCipherCutDeckSSE41,
+     SpiderCipherBackFrontShuffleDeckSSE41,
+     SpiderCipherCutShuffleCutDeckSSE41,
+     SpiderCipherCutShuffleCutCardsSSE41,
+     SpiderCipherFindCardSSE41
+    };
+
+  static const SpiderCipherEngineOps SPIDER_CIPHER_ENGINE_OPS_AVX2 =
+    {
+     SPIDER_CIPHER_ENGINE_AVX2,
+     "avx2",
+     SpiderCipherCutDeckAVX2,
+     SpiderCipherBackFrontShuffleDeckAVX2,
+     SpiderCipherCutShuffleCutDeckAVX2,
+     SpiderCipherCutShuffleCutCardsAVX2,
+     SpiderCipherFindCardAVX2
+    };
+
+  const SpiderCipherEngineOps *SpiderCipherEngineOpsSSE41(void) {
+    __builtin_cpu_init();
+    if (!__builtin_cpu_supports("ssse3")) return NULL;
+    if (!__builtin_cpu_supports("sse4.1")) return NULL;
+    return &SPIDER_CIPHER_ENGINE_OPS_SSE41;
+  }
+
+  const SpiderCipherEngineOps *SpiderCipherEngineOpsAVX2(void) {
+    __builtin_cpu_init();
+    if (!__builtin_cpu_supports("avx2")) return NULL;
+    return &SPIDER_CIPHER_ENGINE_OPS_AVX2;
+  }
+
+#else
+
+  const SpiderCipherEngineOps *SpiderCipherEngineOpsSSE41(void) {
+    return NULL;
+  }
+
+  const SpiderCipherEngineOps *SpiderCipherEngineOpsAVX2(void) {
+    return NULL;
+  }
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "spider_cipher_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  //
+  // Deck permutation engines (internal to the core).
+  //
+  // Every engine works from positions, not cards:
+  //
+  //   cutDeck             - cut so the card at cutAt is on top.
+  //   backFrontShuffleDeck - back-front shuffle.
+  //   cutShuffleCutDeck   - cut at tagAt, back-front shuffle,
+  //                         then cut at cutAt of the shuffled deck.
+  //   cutShuffleCutCards  - the same for 40 cards without ats.
+  //   findCard            - position of card in 40 cards.
+  //
+  // The scalar engine in spider_cipher_core.c is the reference,
+  // the others must give identical decks.
+  //
+
+  typedef struct {
+    int engine;
+    const char *name;
+    void (*cutDeck)(SpiderCipherDeck *input,
+		    uint8_t cutAt,
+		    SpiderCipherDeck *output);
+    void (*backFrontShuffleDeck)(SpiderCipherDeck *input,
+				 SpiderCipherDeck *output);
+    void (*cutShuffleCutDeck)(SpiderCipherDeck *input,
+			      uint8_t tagAt,
+			      uint8_t cutAt,
+			      SpiderCipherDeck *output);
+    void (*cutShuffleCutCards)(SpiderCipherCard *input,
+			       uint8_t tagAt,
+			       uint8_t cutAt,
+			       SpiderCipherCard *output);
+    uint8_t (*findCard)(SpiderCipherCard *cards,
+			SpiderCipherCard card);
+  } SpiderCipherEngineOps;
+
+  // NULL if this build or cpu has no SSE4.1 engine.
+  const SpiderCipherEngineOps *SpiderCipherEngineOpsSSE41(void);
+
+  // NULL if this build or cpu has no AVX2 engine.
+  const SpiderCipherEngineOps *SpiderCipherEngineOpsAVX2(void);
+
+  // Table engine kernels (spider_cipher_table.c); the rest of the
+  // table engine is scalar.
+  void SpiderCipherCutShuffleCutDeckTable(SpiderCipherDeck *input,
+					  uint8_t tagAt,
+					  uint8_t cutAt,
+					  SpiderCipherDeck *output);
+  void SpiderCipherCutShuffleCutCardsTable(SpiderCipherCard *input,
+					   uint8_t tagAt,
+					   uint8_t cutAt,
+					   SpiderCipherCard *output);
+
+#ifdef __cplusplus
+}
+#endif
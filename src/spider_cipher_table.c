@@ -0,0 +1,42 @@
+#include "spider_cipher_simd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  //
+  // Table engine: the whole cut/shuffle/cut is a lookup in the
+  // generated SPIDER_CIPHER_ADVANCE_TABLE (tools/
+  // spider_cipher_advance_table_gen.c), one 40 byte row per
+  // (tagAt,cutAt), then a gather of the cards (and a scatter of
+  // the ats).  No index arithmetic, at the price of 64K of table
+  // competing for the cache, so AUTO never picks it.
+  //
+
+  extern const uint8_t SPIDER_CIPHER_ADVANCE_TABLE[SPIDER_CIPHER_CARDS][SPIDER_CIPHER_CARDS][SPIDER_CIPHER_CARDS];
+
+  void SpiderCipherCutShuffleCutDeckTable(SpiderCipherDeck *input,
+					  uint8_t tagAt,
+					  uint8_t cutAt,
+					  SpiderCipherDeck *output) {
+    const uint8_t *from = SPIDER_CIPHER_ADVANCE_TABLE[tagAt][cutAt];
+    for (uint8_t at=0; at<SPIDER_CIPHER_CARDS; ++at) {
+      SpiderCipherCard card = input->cards[from[at]];
+      output->cards[at]=card;
+      output->ats[card]=at;
+    }
+  }
+
+  void SpiderCipherCutShuffleCutCardsTable(SpiderCipherCard *input,
+					   uint8_t tagAt,
+					   uint8_t cutAt,
+					   SpiderCipherCard *output) {
+    const uint8_t *from = SPIDER_CIPHER_ADVANCE_TABLE[tagAt][cutAt];
+    for (uint8_t at=0; at<SPIDER_CIPHER_CARDS; ++at) {
+      output[at]=input[from[at]];
+    }
+  }
+
+#ifdef __cplusplus
+}
+#endif
@@ -3,14 +3,18 @@
 #endif
 
 #ifndef _POSIX_C_SOURCE
-#define _POSIX_C_SOURCE 1
+#define _POSIX_C_SOURCE 199309L
 #endif
 
 #include <inttypes.h>
 #include <unistd.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <assert.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
 
 #define FACTS_C 1
 #include "facts.h"
@@ -18,7 +22,26 @@ static Facts *head = NULL, *tail = NULL;
 
 uint64_t facts_fictions = 0;
 uint64_t facts_truths = 0;
+uint64_t facts_slowers = 0;
 int facts_format = FACTS_CONSOLE;
+uint64_t facts_seed = FACTS_SEED_DEFAULT;
+int facts_jobs = 1;
+const char *facts_baseline_file = NULL;
+double facts_slower = FACTS_SLOWER_DEFAULT;
+int facts_times = 0;
+
+typedef struct
+{
+  char *name;
+  double wall;
+  double cpu;
+} FactsTime;
+
+static FactsTime *facts_baseline = NULL;
+static int facts_baselines = 0;
+
+// xoshiro256** state, reseeded for every fact.
+static uint64_t facts_random[4];
 
 FACTS_EXTERN void FactsFind();
 FACTS_EXTERN void FactsRegisterAll();
@@ -222,12 +245,16 @@ FACTS_EXTERN void FactsFindInMemory(Facts *begin, Facts *end)
   unsigned char *b = ((unsigned char *)begin);
   unsigned char *e = ((unsigned char *)end) + sizeof(Facts);
 
-  for (unsigned char *p = b;
-       p != NULL && p < e;
-       p = (unsigned char *)memchr(p + FACTS_SIG_LEN, sig[0], e - p))
+  // a signature is only skipped whole when it matched: an sig[0]
+  // byte in pointer data may sit just before a real signature.
+  for (unsigned char *p = (unsigned char *)memchr(b, sig[0], e - b), *next;
+       p != NULL && p + FACTS_SIG_LEN <= e;
+       p = (unsigned char *)memchr(next, sig[0], e - next))
   {
+    next = p + 1;
     if (memcmp(p, sig, FACTS_SIG_LEN) == 0)
     {
+      next = p + FACTS_SIG_LEN;
       Facts *facts = (Facts *)(p - delta);
 
       if (facts->name != NULL && facts->function != NULL && facts->prev == NULL && facts->next == NULL)
@@ -336,8 +363,397 @@ FACTS_EXTERN void FactsPrint(const char *format, ...)
   va_end(ap);
 }
 
+// splitmix64 step, spreads a seed over the xoshiro256** state.
+static uint64_t FactsSplitMix(uint64_t *x)
+{
+  uint64_t z = (*x += 0x9e3779b97f4a7c15ull);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+
+FACTS_EXTERN void FactsRandomSeed(uint64_t seed)
+{
+  for (int i = 0; i < 4; ++i)
+  {
+    facts_random[i] = FactsSplitMix(&seed);
+  }
+}
+
+static uint64_t FactsRotl(uint64_t x, int k)
+{
+  return (x << k) | (x >> (64 - k));
+}
+
+// xoshiro256** (Blackman and Vigna).
+FACTS_EXTERN uint64_t FactsRandom()
+{
+  uint64_t *s = facts_random;
+  uint64_t result = FactsRotl(s[1] * 5, 7) * 9;
+  uint64_t t = s[1] << 17;
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = FactsRotl(s[3], 45);
+  return result;
+}
+
+// Unbiased 0..n-1 by Lemire's multiply and shift: the low half of
+// the product only needs the (dividing) threshold when it is below
+// n, which is rare for small n.
+FACTS_EXTERN uint32_t FactsRandomRange(uint32_t n)
+{
+  uint64_t m = (FactsRandom() >> 32) * (uint64_t)n;
+  uint32_t low = (uint32_t)m;
+  if (low < n)
+  {
+    uint32_t threshold = -n % n;
+    while (low < threshold)
+    {
+      m = (FactsRandom() >> 32) * (uint64_t)n;
+      low = (uint32_t)m;
+    }
+  }
+  return (uint32_t)(m >> 32);
+}
+
+// Each fact gets a stream from the seed and its name, so a fact
+// sees the same numbers alone (--facts_include) as in a full run.
+static void FactsRandomSeedFor(Facts *facts)
+{
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (const char *c = facts->name; *c != 0; ++c)
+  {
+    hash = (hash ^ (uint8_t)*c) * 0x100000001b3ull;
+  }
+  FactsRandomSeed(facts_seed ^ hash);
+}
+
 #define FACTS_BLOCKSIZE 1024
-// Execute facts checks.
+
+// Copy all of file f to stdout, by its fd (a worker or dup2 moved
+// the offset behind stdio).
+static void FactsCopy(FILE *f)
+{
+  int fd = fileno(f);
+  lseek(fd, 0, SEEK_SET);
+  for (;;)
+  {
+    char data[FACTS_BLOCKSIZE];
+    ssize_t n = read(fd, data, sizeof(data));
+    if (n <= 0)
+    {
+      break;
+    }
+    if (fwrite(data, n, 1, stdout) != 1)
+    {
+      break;
+    }
+  }
+}
+
+// A capture tmpfile: there is no way to check the fact without one.
+static FILE *FactsTmpfile(void)
+{
+  FILE *f = tmpfile();
+  if (f == NULL)
+  {
+    perror("facts tmpfile");
+    exit(2);
+  }
+  return f;
+}
+
+static void FactsRedirect(FILE *f, int fd)
+{
+  if (dup2(fileno(f), fd) < 0)
+  {
+    perror("facts dup2");
+    exit(2);
+  }
+}
+
+static double FactsSeconds(clockid_t clock)
+{
+  struct timespec t;
+  clock_gettime(clock, &t);
+  return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+//
+// --facts_baseline=file holds "name wall cpu" lines (seconds) from
+// an earlier run.  A fact whose cpu time grew more than
+// --facts_slower=percent (and FACTS_BASELINE_MIN seconds) over its
+// baseline is flagged slower.  cpu time is compared since it does
+// not depend on --facts_jobs or a busy machine.
+//
+
+#define FACTS_BASELINE_MIN 0.01
+
+// baseline cpu seconds of facts, or < 0 when it has none.
+static double FactsBaseline(Facts *facts)
+{
+  for (int i = 0; i < facts_baselines; ++i)
+  {
+    if (strcmp(facts_baseline[i].name, facts->name) == 0)
+    {
+      return facts_baseline[i].cpu;
+    }
+  }
+  return -1.0;
+}
+
+static int FactsSlower(Facts *facts)
+{
+  double baseline = FactsBaseline(facts);
+  return facts->status == FACTS_STATE_PASS && baseline >= 0.0 &&
+         facts->cpu > baseline * (1.0 + facts_slower / 100.0) &&
+         facts->cpu > baseline + FACTS_BASELINE_MIN;
+}
+
+// Check one fact (as a JUnit testcase in that format).
+static void FactsCheckOne(Facts *facts)
+{
+  FILE *tmpout = NULL, *tmperr = NULL;
+  int oldout = -1, olderr = -1;
+  if (facts_format == FACTS_JUNIT)
+  {
+    // the testcase time is known after the check.
+    fflush(stdout);
+    fflush(stderr);
+    tmpout = FactsTmpfile();
+    tmperr = FactsTmpfile();
+    oldout = dup(STDOUT_FILENO);
+    olderr = dup(STDERR_FILENO);
+    FactsRedirect(tmpout, STDOUT_FILENO);
+    FactsRedirect(tmperr, STDERR_FILENO);
+  }
+  facts->wall = 0.0;
+  facts->cpu = 0.0;
+  if (facts->status == FACTS_STATE_INCLUDE)
+  {
+    printf("%s %d: %s facts check started\n",
+           facts->file, facts->line, facts->name);
+    FactsRandomSeedFor(facts);
+    double wall = FactsSeconds(CLOCK_MONOTONIC);
+    double cpu = FactsSeconds(CLOCK_PROCESS_CPUTIME_ID);
+    facts->function(facts);
+    facts->cpu = FactsSeconds(CLOCK_PROCESS_CPUTIME_ID) - cpu;
+    facts->wall = FactsSeconds(CLOCK_MONOTONIC) - wall;
+    if (facts->status == FACTS_STATE_INCLUDE)
+    {
+      facts->status = FACTS_STATE_PASS;
+    }
+    printf("%s %d: %s facts check ended%s",
+           facts->file, facts->line, facts->name,
+           (facts->status == FACTS_STATE_FAIL ? " " FACTS_RED "badly" FACTS_RESET : ""));
+    // times only on request, so the console output stays the same
+    // from run to run (make check diffs it).
+    if (facts_times)
+    {
+      printf(" in %.3fs (%.3fs cpu)", facts->wall, facts->cpu);
+    }
+    printf("\n");
+    if (FactsSlower(facts))
+    {
+      printf("%s %d: %s facts check " FACTS_RED "slower" FACTS_RESET
+             " than its %.3fs cpu baseline\n",
+             facts->file, facts->line, facts->name, FactsBaseline(facts));
+    }
+  }
+  else
+  {
+    printf("%s %d: %s facts check " FACTS_RED "excluded" FACTS_RESET ".\n",
+           facts->file, facts->line, facts->name);
+  }
+  if (facts_format == FACTS_JUNIT)
+  {
+    fflush(stdout);
+    fflush(stderr);
+    dup2(oldout, STDOUT_FILENO);
+    dup2(olderr, STDERR_FILENO);
+    printf("<testcase name=\"%s\" time=\"%.6f\">\n", facts->name, facts->wall);
+    printf("<system-out>");
+    FactsCopy(tmpout);
+    printf("</system-out>\n");
+    if (lseek(fileno(tmperr), 0, SEEK_END) > 0)
+    {
+      printf("<system-err>");
+      FactsCopy(tmperr);
+      printf("</system-err>\n");
+    }
+    if (facts->status == FACTS_STATE_EXCLUDE)
+    {
+      printf("<skipped />\n");
+    }
+    if (facts->status == FACTS_STATE_FAIL)
+    {
+      printf("<failure>See stdout</failure>\n");
+    }
+    printf("</testcase>\n\n");
+    fclose(tmpout);
+    fclose(tmperr);
+    close(oldout);
+    close(olderr);
+  }
+}
+
+//
+// --facts_jobs=n runs facts in n forked workers.  Each worker
+// writes to its own tmpfile and sends back its counts and status;
+// outputs are copied to stdout in list order, so the output (and
+// the summary) is the same as checking one fact after another.
+//
+
+typedef struct
+{
+  uint64_t truths;
+  uint64_t fictions;
+  int status;
+  double wall;
+  double cpu;
+} FactsResult;
+
+typedef struct
+{
+  Facts *facts;
+  pid_t pid;
+  FILE *out;
+  int result;
+} FactsJob;
+
+static void FactsJobStart(FactsJob *job, Facts *facts)
+{
+  int fds[2];
+  job->facts = facts;
+  job->pid = -1;
+  job->result = -1;
+  job->out = tmpfile();
+  if (job->out == NULL || pipe(fds) != 0)
+  {
+    // no worker, so the fact is reported crashed.
+    perror("facts job");
+    return;
+  }
+  fflush(stdout);
+  fflush(stderr);
+  job->pid = fork();
+  if (job->pid == 0)
+  {
+    close(fds[0]);
+    FactsRedirect(job->out, STDOUT_FILENO);
+    facts_truths = 0;
+    facts_fictions = 0;
+    FactsCheckOne(facts);
+    fflush(stdout);
+    FactsResult result = {facts_truths, facts_fictions, facts->status,
+                          facts->wall, facts->cpu};
+    _exit(write(fds[1], &result, sizeof(result)) == sizeof(result) ? 0 : 1);
+  }
+  close(fds[1]);
+  job->result = fds[0];
+  if (job->pid < 0)
+  {
+    // no worker, so the read below sees the fact crash.
+    close(job->result);
+    job->result = -1;
+  }
+}
+
+static void FactsJobFinish(FactsJob *job)
+{
+  Facts *facts = job->facts;
+  FactsResult result;
+  ssize_t got = -1;
+  if (job->result >= 0)
+  {
+    got = read(job->result, &result, sizeof(result));
+    close(job->result);
+    waitpid(job->pid, NULL, 0);
+  }
+
+  if (job->out != NULL)
+  {
+    FactsCopy(job->out);
+    fclose(job->out);
+  }
+
+  if (got == (ssize_t)sizeof(result))
+  {
+    facts_truths += result.truths;
+    facts_fictions += result.fictions;
+    facts->status = result.status;
+    facts->wall = result.wall;
+    facts->cpu = result.cpu;
+  }
+  else
+  {
+    printf("%s %d: %s facts check " FACTS_RED "crashed" FACTS_RESET "\n",
+           facts->file, facts->line, facts->name);
+    ++facts_fictions;
+    facts->status = FACTS_STATE_FAIL;
+  }
+}
+
+// Read the baseline file (0 - there is none).
+static int FactsBaselineRead(const char *file)
+{
+  FILE *f = fopen(file, "r");
+  if (f == NULL)
+  {
+    return 0;
+  }
+  char name[256];
+  double wall, cpu;
+  while (fscanf(f, "%255s %lf %lf", name, &wall, &cpu) == 3)
+  {
+    size_t size = strlen(name) + 1;
+    FactsTime *more = (FactsTime *)realloc(facts_baseline, (facts_baselines + 1) * sizeof(FactsTime));
+    char *copy = (char *)malloc(size);
+    if (more == NULL || copy == NULL)
+    {
+      // the times read so far still count.
+      perror(file);
+      free(copy);
+      if (more != NULL)
+      {
+        facts_baseline = more;
+      }
+      break;
+    }
+    facts_baseline = more;
+    facts_baseline[facts_baselines].name = copy;
+    memcpy(copy, name, size);
+    facts_baseline[facts_baselines].wall = wall;
+    facts_baseline[facts_baselines].cpu = cpu;
+    ++facts_baselines;
+  }
+  fclose(f);
+  return 1;
+}
+
+// Record the passed facts' times as the baseline.
+static void FactsBaselineWrite(const char *file)
+{
+  FILE *f = fopen(file, "w");
+  if (f == NULL)
+  {
+    perror(file);
+    return;
+  }
+  for (Facts *facts = head; facts != NULL; facts = facts->next)
+  {
+    if (facts->status == FACTS_STATE_PASS)
+    {
+      fprintf(f, "%s %.6f %.6f\n", facts->name, facts->wall, facts->cpu);
+    }
+  }
+  fclose(f);
+}
+
+// Execute facts checks (in turn, or with --facts_jobs=n workers).
 //
 // You can preceed this with FactsInclude and FactsExlude to pick out
 // a particular set.
@@ -345,87 +761,54 @@ FACTS_EXTERN void FactsPrint(const char *format, ...)
 //
 FACTS_EXTERN void FactsCheck()
 {
-  int fails = 0;
   if (head == NULL)
   {
     FactsRegisterAll();
   }
 
-  FILE *tmpout = NULL, *tmperr = NULL;
-  int oldout = -1, olderr = -1;
+  int baseline = facts_baseline_file != NULL && FactsBaselineRead(facts_baseline_file);
+  double wall = FactsSeconds(CLOCK_MONOTONIC);
   if (facts_format == FACTS_JUNIT)
   {
     printf("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
     printf("<testsuite name=\"facts\">\n");
   }
-  for (Facts *facts = head; facts != NULL; facts = facts->next)
+  if (facts_jobs > 1)
   {
-    if (facts_format == FACTS_JUNIT)
-    {
-      printf("<testcase name=\"%s\">\n", facts->name);
-      printf("<system-out>");      
-      fflush(stderr);
-      assert((tmperr = tmpfile()) != NULL);
-      olderr = dup(STDERR_FILENO);
-      assert(dup2(fileno(tmperr), STDERR_FILENO) >= 0);
-    }
-    if (facts->status == FACTS_STATE_INCLUDE)
+    FactsJob jobs[facts_jobs];
+    Facts *next = head;
+    int started = 0, finished = 0;
+    for (Facts *facts = head; facts != NULL; facts = facts->next)
     {
-      printf("%s %d: %s facts check started\n",
-             facts->file, facts->line, facts->name);
-      facts->function(facts);
-      if (facts->status == FACTS_STATE_INCLUDE)
-      {
-        facts->status = FACTS_STATE_PASS;
-      }
-      if (facts->status == FACTS_STATE_FAIL)
+      for (; next != NULL && started - finished < facts_jobs; next = next->next)
       {
-        ++fails;
+        FactsJobStart(&jobs[started++ % facts_jobs], next);
       }
-      printf("%s %d: %s facts check ended%s\n",
-             facts->file, facts->line, facts->name,
-             (facts->status == FACTS_STATE_FAIL ? " " FACTS_RED "badly" FACTS_RESET : ""));
+      FactsJobFinish(&jobs[finished++ % facts_jobs]);
     }
-    else
+  }
+  else
+  {
+    for (Facts *facts = head; facts != NULL; facts = facts->next)
     {
-      printf("%s %d: %s facts check " FACTS_RED "excluded" FACTS_RESET ".\n",
-             facts->file, facts->line, facts->name);
-    }
-    if (facts_format == FACTS_JUNIT)
-    {
-      fflush(stdout);
-      fflush(stderr);
-      printf("</system-out>\n");      
-      int64_t errlen = lseek(STDERR_FILENO, 0, SEEK_CUR);
-      dup2(olderr, STDERR_FILENO);
-      fseek(tmperr, 0L, SEEK_SET);
-      if (errlen > 0) {
-	printf("<system-err>");
-	for (int64_t p = 0; p < errlen; p += FACTS_BLOCKSIZE)
-	  {
-	    char data[FACTS_BLOCKSIZE];
-	    int n = errlen - p;
-	    if (n > FACTS_BLOCKSIZE) {
-	      n = FACTS_BLOCKSIZE;
-	    }
-	    assert(fread(data, n, 1, tmperr)==1);
-	    assert(fwrite(data, n, 1, stdout)==1);
-	  }
-	printf("</system-err>\n");
-      }
-      if (facts->status == FACTS_STATE_EXCLUDE)
-      {
-        printf("<skipped />\n");
-      }
-      if (facts->status == FACTS_STATE_FAIL)
-      {
-        printf("<failure>See stdout</failure>\n");
-      }
-      printf("</testcase>\n\n");
-      fclose(tmperr);
-      close(olderr);
+      FactsCheckOne(facts);
+    }
+  }
+
+  wall = FactsSeconds(CLOCK_MONOTONIC) - wall;
+  double cpu = 0.0;
+  for (Facts *facts = head; facts != NULL; facts = facts->next)
+  {
+    cpu += facts->cpu;
+    if (FactsSlower(facts))
+    {
+      ++facts_slowers;
     }
   }
+  if (facts_baseline_file != NULL && !baseline)
+  {
+    FactsBaselineWrite(facts_baseline_file);
+  }
 
   if (facts_format == FACTS_CONSOLE)
   {
@@ -434,7 +817,21 @@ FACTS_EXTERN void FactsCheck()
     {
       if (facts->status == FACTS_STATE_PASS)
       {
-        printf("facts check %s " FACTS_GREEN "passed" FACTS_RESET "\n", facts->name);
+        printf("facts check %s " FACTS_GREEN "passed" FACTS_RESET, facts->name);
+        if (facts_times)
+        {
+          printf(" in %.3fs (%.3fs cpu)", facts->wall, facts->cpu);
+        }
+        printf("\n");
+      }
+    }
+    for (Facts *facts = head; facts != NULL; facts = facts->next)
+    {
+      if (FactsSlower(facts))
+      {
+        double was = FactsBaseline(facts);
+        printf("facts check %s " FACTS_RED "slower" FACTS_RESET " %.3fs cpu vs %.3fs baseline (+%.0f%%)\n",
+               facts->name, facts->cpu, was, 100.0 * (facts->cpu - was) / was);
       }
     }
     for (Facts *facts = head; facts != NULL; facts = facts->next)
@@ -464,6 +861,10 @@ FACTS_EXTERN void FactsCheck()
     double rate = 100.0 / (checks > 0.0 ? checks : 1.0);
     printf("%" PRIu64 " (%1.1f%%) truths and %" PRIu64 " (%1.1f%%) fictions checked.\n",
            facts_truths, facts_truths * rate, facts_fictions, facts_fictions * rate);
+    if (facts_times)
+    {
+      printf("facts checked in %.3fs (%.3fs cpu).\n", wall, cpu);
+    }
   }
 
   if (facts_format == FACTS_JUNIT)
@@ -476,7 +877,8 @@ FACTS_EXTERN void FactsCheck()
 // You can call this from your main to process facts
 // checks.  Return status 0 is good, it means a fact check was
 // called and passed all (at least one) FACT check, 1 means at
-// least one FACT failed, and 2 means no facts were checked.
+// least one FACT failed (or a fact was slower than its
+// --facts_baseline), and 2 means no facts were checked.
 //
 //
 FACTS_EXTERN int FactsMain(int argc, const char *argv[])
@@ -502,6 +904,50 @@ FACTS_EXTERN int FactsMain(int argc, const char *argv[])
         continue;
       }
     }
+    {
+      const char *op = "--facts_seed=";
+      if (strncmp(arg, op, strlen(op)) == 0)
+      {
+        facts_seed = strtoull(arg + strlen(op), NULL, 0);
+        continue;
+      }
+    }
+    {
+      const char *op = "--facts_jobs=";
+      if (strncmp(arg, op, strlen(op)) == 0)
+      {
+        facts_jobs = atoi(arg + strlen(op));
+        if (facts_jobs <= 0)
+        {
+          facts_jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        }
+        continue;
+      }
+    }
+    {
+      const char *op = "--facts_baseline=";
+      if (strncmp(arg, op, strlen(op)) == 0)
+      {
+        facts_baseline_file = arg + strlen(op);
+        continue;
+      }
+    }
+    {
+      const char *op = "--facts_times";
+      if (strcmp(arg, op) == 0)
+      {
+        facts_times = 1;
+        continue;
+      }
+    }
+    {
+      const char *op = "--facts_slower=";
+      if (strncmp(arg, op, strlen(op)) == 0)
+      {
+        facts_slower = atof(arg + strlen(op));
+        continue;
+      }
+    }
     {
       const char *op = "--facts_find";
       if (strcmp(arg, op) == 0)
@@ -550,6 +996,13 @@ FACTS_EXTERN int FactsMain(int argc, const char *argv[])
         printf("default is to check all registered facts\n");
         printf("    --facts_include=\"*wildcard pattern*\"\n --- include certain facts\n");
         printf("    --facts_exclude=\"*wildcard pattern*\"\n --- exclude certain facts\n");
+        printf("    --facts_seed=n\n --- seed of FactsRandom (default %llu)\n",
+               (unsigned long long)FACTS_SEED_DEFAULT);
+        printf("    --facts_jobs=n\n --- check facts in n worker processes (0 - one per cpu)\n");
+        printf("    --facts_baseline=file\n --- flag facts slower than the times in file (made if missing)\n");
+        printf("    --facts_slower=percent\n --- slower is over baseline cpu time + percent (default %g)\n",
+               (double)FACTS_SLOWER_DEFAULT);
+        printf("    --facts_times --- show the wall and cpu time of each fact\n");
         printf("    --facts_register_all --- auto* generate FACTS_REGISTER_ALL\n");
         printf("    --facts_find --- auto* find facts\n");
         printf("    --facts_skip --- don't fact check\n");
@@ -567,5 +1020,5 @@ FACTS_EXTERN int FactsMain(int argc, const char *argv[])
     FactsCheck();
   }
 
-  return (facts_fictions == 0) ? 0 : 1;
+  return (facts_fictions == 0 && facts_slowers == 0) ? 0 : 1;
 }
@@ -36,6 +36,8 @@ extern "C"
 #define FACTS_STATE_INCLUDE 0
 #define FACTS_STATE_PASS 1
 
+#define FACTS_SLOWER_DEFAULT 20
+
 #define FACTS_CONSOLE 0
 #define FACTS_JUNIT 1
 
@@ -49,6 +51,9 @@ extern "C"
     int status;
     Facts *next;
     Facts *prev;
+    // seconds of the last check.
+    double wall;
+    double cpu;
   };
 
   void FactsPrint(const char *fmt, ...);
@@ -60,6 +65,18 @@ extern "C"
   void FactsFiction(const char *file, int line, Facts *facts,
 		    const char *a, const char *op, const char *b);
 
+  //
+  // Seeded xoshiro256** for facts that need random numbers: every
+  // fact starts from --facts_seed=n (and its name), so a run is
+  // replayed by giving the same seed.
+  //
+#define FACTS_SEED_DEFAULT 1
+
+  void FactsRandomSeed(uint64_t seed);
+  uint64_t FactsRandom();
+  // 0..n-1, unbiased.
+  uint32_t FactsRandomRange(uint32_t n);
+
   double FactsAbsErr(double a, double b);
   double FactsRelErr(double a, double b);
 
@@ -112,6 +129,12 @@ extern "C"
   extern uint64_t facts_fictions;
   extern uint64_t facts_truths;
   extern int facts_format;
+  extern uint64_t facts_seed;
+  extern int facts_jobs;
+  extern const char *facts_baseline_file;
+  extern double facts_slower;
+  extern int facts_times;
+  extern uint64_t facts_slowers;
 #endif
 
 #define FACT_CHECK_PRINT(a, op, b, fmt) (((a)op(b)) ? (++facts_truths, 1) : (FactsPrint(FACTS_RED "%s/%s %d: %s {=%?} " #op " %s {=%?} is fiction" FACTS_RESET "\n", fmt, fmt, __FILE__, facts->name, __LINE__, #a, (a), #b, (b)), FactsFiction(__FILE__, __LINE__, facts, #a, #op, #b), facts->status = -1, 0))
@@ -136,7 +159,7 @@ extern "C"
 
 #define FACTS_DECLARE(name, state)                                                                                 \
   void facts_##name##_function(Facts *facts);                                                                      \
-  Facts facts_##name##_data = {FACTS_SIG, __FILE__, __LINE__, #name, &facts_##name##_function, state, NULL, NULL}; \
+  Facts facts_##name##_data = {FACTS_SIG, __FILE__, __LINE__, #name, &facts_##name##_function, state, NULL, NULL, 0.0, 0.0}; \
   void facts_##name##_function(Facts *facts)
 
 #define FACTS_INCLUDE(name) FACTS_DECLARE(name, FACTS_STATE_INCLUDE)
@@ -0,0 +1,149 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "facts.h"
+
+//
+// As with the core facts, include the source to get at the
+// static step kernels.
+//
+
+#include "../src/spider_cipher_batch.c"
+#include "spider_cipher_samples.h"
+
+#define CARDS SPIDER_CIPHER_CARDS
+#define LANES SPIDER_CIPHER_BATCH_LANES
+#define PACKET 61
+
+typedef SpiderCipherDeck Deck;
+typedef SpiderCipherCard Card;
+
+int cardsCmp(int n, const Card *a, const Card *b) {
+  for (int i=0; i<n; ++i) {
+    if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+  }
+  return 0;
+}
+
+// lane's sample deck in the k-th batch
+void laneDeck(Deck *deck, int k, int lane) {
+  int ab = (k*LANES+lane) % (CARDS*(CARDS+1));
+  sampleDeck(deck,1+ab/(CARDS+1),ab%(CARDS+1));
+}
+
+int engines[] = { SPIDER_CIPHER_ENGINE_SCALAR, SPIDER_CIPHER_ENGINE_AVX2 };
+int laneCounts[] = { 8, 16, 32 };
+
+FACTS(BatchInit) {
+  SpiderCipherDeckBatch batch;
+  FACT(SpiderCipherDeckBatchInit(&batch,7),==,0);
+  FACT(SpiderCipherDeckBatchInit(&batch,33),==,0);
+  for (int n=0; n<3; ++n) {
+    FACT(SpiderCipherDeckBatchInit(&batch,laneCounts[n]),==,1);
+    for (int lane=0; lane<laneCounts[n]; ++lane) {
+      Deck deck,id;
+      SpiderCipherDeckInit(&id);
+      SpiderCipherDeckBatchGet(&batch,lane,&deck);
+      FACT(deckCmp(&deck,&id),==,0);
+      laneDeck(&id,n,lane);
+      SpiderCipherDeckBatchSet(&batch,lane,&id);
+      SpiderCipherDeckBatchGet(&batch,lane,&deck);
+      FACT(deckCmp(&deck,&id),==,0);
+    }
+  }
+}
+
+FACTS(BatchStep) {
+  int was = SpiderCipherEngine();
+  for (int e=0; e<2; ++e) {
+    if (!SpiderCipherEngineSelect(engines[e])) continue;
+    for (int n=0; n<3; ++n) {
+      int lanes = laneCounts[n];
+      for (int k=0; k<4; ++k) {
+	SpiderCipherDeckBatch batch;
+	Deck decks[LANES],spare,deck;
+	SpiderCipherDeckBatchInit(&batch,lanes);
+	for (int lane=0; lane<lanes; ++lane) {
+	  laneDeck(&decks[lane],k,lane);
+	  SpiderCipherDeckBatchSet(&batch,lane,&decks[lane]);
+	}
+	for (int i=0; i<PACKET; ++i) {
+	  Card clear[LANES],scrambled[LANES],unscrambled[LANES],expect[LANES];
+	  for (int lane=0; lane<lanes; ++lane) {
+	    clear[lane] = (7*i+3*lane+k) % CARDS;
+	    expect[lane] = SpiderCipherScramble(&decks[lane],clear[lane]);
+	  }
+	  SpiderCipherBatchScramble(&batch,clear,scrambled);
+	  FACT(cardsCmp(lanes,scrambled,expect),==,0);
+	  SpiderCipherBatchUnscramble(&batch,scrambled,unscrambled);
+	  FACT(cardsCmp(lanes,unscrambled,clear),==,0);
+	  SpiderCipherBatchAdvanceDeck(&batch,clear);
+	  for (int lane=0; lane<lanes; ++lane) {
+	    SpiderCipherAdvanceDeck(&decks[lane],clear[lane],&spare);
+	    SpiderCipherDeckBatchGet(&batch,lane,&deck);
+	    FACT(deckCmp(&deck,&decks[lane]),==,0);
+	  }
+	}
+      }
+    }
+  }
+  SpiderCipherEngineSelect(was);
+}
+
+FACTS(BatchBuffer) {
+  int was = SpiderCipherEngine();
+  for (int e=0; e<2; ++e) {
+    if (!SpiderCipherEngineSelect(engines[e])) continue;
+    for (int n=0; n<3; ++n) {
+      int lanes = laneCounts[n];
+      for (int k=0; k<4; ++k) {
+	SpiderCipherDeckBatch batch,unbatch;
+	Deck decks[LANES],deck;
+	Card clear[LANES][PACKET],expect[LANES][PACKET];
+	Card scrambled[LANES][PACKET],unscrambled[LANES][PACKET];
+	const Card *in[LANES];
+	Card *out[LANES];
+	SpiderCipherDeckBatchInit(&batch,lanes);
+	SpiderCipherDeckBatchInit(&unbatch,lanes);
+	for (int lane=0; lane<lanes; ++lane) {
+	  laneDeck(&decks[lane],k,lane);
+	  SpiderCipherDeckBatchSet(&batch,lane,&decks[lane]);
+	  SpiderCipherDeckBatchSet(&unbatch,lane,&decks[lane]);
+	  for (int i=0; i<PACKET; ++i) {
+	    clear[lane][i] = (i*i+lane+k) % CARDS;
+	  }
+	  SpiderCipherScrambleBuffer(&decks[lane],clear[lane],expect[lane],PACKET);
+	  in[lane] = clear[lane];
+	  out[lane] = scrambled[lane];
+	}
+	SpiderCipherBatchScrambleBuffer(&batch,in,out,PACKET);
+	for (int lane=0; lane<lanes; ++lane) {
+	  FACT(cardsCmp(PACKET,scrambled[lane],expect[lane]),==,0);
+	  SpiderCipherDeckBatchGet(&batch,lane,&deck);
+	  FACT(deckCmp(&deck,&decks[lane]),==,0);
+	  in[lane] = scrambled[lane];
+	  out[lane] = unscrambled[lane];
+	}
+	SpiderCipherBatchUnscrambleBuffer(&unbatch,in,out,PACKET);
+	for (int lane=0; lane<lanes; ++lane) {
+	  FACT(cardsCmp(PACKET,unscrambled[lane],clear[lane]),==,0);
+	}
+
+	// in place
+	for (int lane=0; lane<lanes; ++lane) {
+	  laneDeck(&deck,k,lane);
+	  SpiderCipherDeckBatchSet(&batch,lane,&deck);
+	  in[lane] = out[lane] = clear[lane];
+	}
+	SpiderCipherBatchScrambleBuffer(&batch,in,out,PACKET);
+	for (int lane=0; lane<lanes; ++lane) {
+	  FACT(cardsCmp(PACKET,clear[lane],expect[lane]),==,0);
+	}
+      }
+    }
+  }
+  SpiderCipherEngineSelect(was);
+}
+
+FACTS_FAST
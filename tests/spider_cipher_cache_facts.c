@@ -0,0 +1,116 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "facts.h"
+#include "spider_cipher_cache.h"
+#include "spider_cipher_samples.h"
+
+#define CARDS SPIDER_CIPHER_CARDS
+#define SLOTS SPIDER_CIPHER_DECK_CACHE_SLOTS
+
+typedef SpiderCipherDeck Deck;
+typedef SpiderCipherCard Card;
+
+Card keyAt(uint8_t at, void *misc) {
+  return ((Card*) misc)[at];
+}
+
+SpiderCipherDeckCache cache;
+
+FACTS(CacheHitMiss) {
+  Card key[CARDS];
+  Deck deck,expect;
+  SpiderCipherDeckCacheInit(&cache);
+  sampleKey(key,7,3);
+  SpiderCipherDeckInitBy(&expect,keyAt,key);
+
+  memset(&deck,0,sizeof(deck));
+  FACT(SpiderCipherDeckCacheGet(&cache,key,&deck),==,1);
+  FACT(deckCmp(&deck,&expect),==,0);
+  FACT(cache.misses,==,1);
+  FACT(cache.hits,==,0);
+
+  memset(&deck,0,sizeof(deck));
+  FACT(SpiderCipherDeckCacheGet(&cache,key,&deck),==,1);
+  FACT(deckCmp(&deck,&expect),==,0);
+  FACT(cache.misses,==,1);
+  FACT(cache.hits,==,1);
+
+  memset(&deck,0,sizeof(deck));
+  FACT(SpiderCipherDeckCacheGetBy(&cache,keyAt,key,&deck),==,1);
+  FACT(deckCmp(&deck,&expect),==,0);
+  FACT(cache.hits,==,2);
+
+  SpiderCipherDeckInit(&expect);
+  FACT(SpiderCipherDeckCacheGetBy(&cache,NULL,NULL,&deck),==,1);
+  FACT(deckCmp(&deck,&expect),==,0);
+  FACT(cache.misses,==,2);
+}
+
+FACTS(CacheBadKey) {
+  Card key[CARDS];
+  Deck deck;
+  SpiderCipherDeckCacheInit(&cache);
+  sampleKey(key,7,3);
+  key[5]=key[6];
+  FACT(SpiderCipherDeckCacheGet(&cache,key,&deck),==,0);
+  FACT(SpiderCipherDeckCacheGet(&cache,key,&deck),==,0);
+  FACT(cache.misses,==,2);
+  FACT(cache.hits,==,0);
+  key[5]=CARDS;
+  FACT(SpiderCipherDeckCacheGet(&cache,key,&deck),==,0);
+  int used = 0;
+  for (int i=0; i<SLOTS; ++i) used += (cache.hashes[i] != 0);
+  FACT(used,==,0);
+}
+
+// every (a,b) key, with one hot key between each: every answer is
+// right, the cache fills and evicts, and the hot key always hits.
+FACTS(CacheEvict) {
+  Card hot[CARDS],key[CARDS];
+  Deck deck,expect,hotDeck;
+  uint64_t gets = 0;
+  int wrong = 0, cold = 0;
+  SpiderCipherDeckCacheInit(&cache);
+  sampleKey(hot,11,5);
+  SpiderCipherDeckInitBy(&hotDeck,keyAt,hot);
+  SpiderCipherDeckCacheGet(&cache,hot,&deck);
+  ++gets;
+  for (int a=1; a<=CARDS; ++a) {
+    for (int b=0; b<=CARDS; ++b) {
+      sampleKey(key,a,b);
+      SpiderCipherDeckInitBy(&expect,keyAt,key);
+      if (!SpiderCipherDeckCacheGet(&cache,key,&deck)) ++wrong;
+      if (deckCmp(&deck,&expect) != 0) ++wrong;
+      uint64_t hits = cache.hits;
+      if (!SpiderCipherDeckCacheGet(&cache,hot,&deck)) ++wrong;
+      if (deckCmp(&deck,&hotDeck) != 0) ++wrong;
+      if (cache.hits != hits+1) ++cold;
+      gets += 2;
+    }
+  }
+  FACT(wrong,==,0);
+  FACT(cold,==,0);
+  FACT(cache.hits+cache.misses,==,gets);
+  FACT(cache.evictions,>,0);
+  uint64_t used = 0;
+  for (int i=0; i<SLOTS; ++i) used += (cache.hashes[i] != 0);
+  FACT(cache.misses-cache.evictions,==,used);
+}
+
+FACTS(CacheWipe) {
+  Card key[CARDS];
+  Deck deck;
+  static SpiderCipherDeckCache zero;
+  SpiderCipherDeckCacheInit(&cache);
+  for (int b=0; b<=CARDS; ++b) {
+    sampleKey(key,3,b);
+    SpiderCipherDeckCacheGet(&cache,key,&deck);
+  }
+  FACT(memcmp(&cache,&zero,sizeof(cache)) != 0,==,1);
+  SpiderCipherDeckCacheInit(&cache);
+  FACT(memcmp(&cache,&zero,sizeof(cache)),==,0);
+}
+
+FACTS_FAST
@@ -0,0 +1,81 @@
+#!/bin/sh
+#
+# Check the bin/spider_cipher tool end to end:
+#
+#   sh tests/spider_cipher_check.sh bin/spider_cipher
+#
+# Scrambles and unscrambles an 80000 card message (more than one
+# chunk) to a separate out, in place, and with out the same file as
+# in.  A bad card at 70000 (in the second chunk) must exit 2, cut a
+# separate out to the 70000 cards before it, and leave an in place
+# input as it was.
+#
+
+tool=${1:-bin/spider_cipher}
+dir=$(mktemp -d) || exit 2
+trap 'rm -rf "$dir"' EXIT
+
+fail() {
+  echo "spider_cipher check: $*" >&2
+  exit 1
+}
+
+# cards $1 $2 .. $3 (one byte each), by $2 - $1.
+cards() {
+  for at in $(seq "$1" "$2" "$3"); do
+    printf "\\$(printf %03o "$at")"
+  done
+}
+
+size() {
+  wc -c <"$1" | tr -d ' '
+}
+
+cards 39 -1 0 >"$dir/key"
+cards 0 1 39 >"$dir/msg"
+# 40 cards doubled 11 times is 81920, cut to 80000.
+for i in 1 2 3 4 5 6 7 8 9 10 11; do
+  cat "$dir/msg" "$dir/msg" >"$dir/tmp" && mv "$dir/tmp" "$dir/msg"
+done
+head -c 80000 "$dir/msg" >"$dir/tmp" && mv "$dir/tmp" "$dir/msg"
+
+# separate out
+"$tool" --scramble --key="$dir/key" "$dir/msg" "$dir/out" ||
+  fail "scramble to out failed"
+[ "$(size "$dir/out")" = 80000 ] || fail "scrambled out is not 80000 cards"
+cmp -s "$dir/msg" "$dir/out" && fail "scrambled out is the message"
+"$tool" --unscramble --key="$dir/key" "$dir/out" "$dir/back" ||
+  fail "unscramble to out failed"
+cmp "$dir/msg" "$dir/back" || fail "unscrambled out is not the message"
+
+# in place
+cp "$dir/msg" "$dir/place"
+"$tool" --scramble --key="$dir/key" "$dir/place" ||
+  fail "scramble in place failed"
+cmp "$dir/out" "$dir/place" || fail "in place scramble differs from out"
+"$tool" --unscramble --key="$dir/key" "$dir/place" ||
+  fail "unscramble in place failed"
+cmp "$dir/msg" "$dir/place" || fail "in place unscramble is not the message"
+
+# out the same file as in (by another name)
+cp "$dir/msg" "$dir/same"
+"$tool" --scramble --key="$dir/key" "$dir/same" "$dir/../$(basename "$dir")/same" ||
+  fail "scramble to the same file failed"
+cmp "$dir/out" "$dir/same" || fail "same file scramble differs from out"
+
+# a bad card at 70000
+{ head -c 70000 "$dir/msg"; printf '\115'; tail -c +70002 "$dir/msg"; } >"$dir/bad"
+[ "$(size "$dir/bad")" = 80000 ] || fail "bad message is not 80000 bytes"
+
+"$tool" --scramble --key="$dir/key" "$dir/bad" "$dir/badout" 2>/dev/null
+[ $? = 2 ] || fail "bad card to out did not exit 2"
+[ "$(size "$dir/badout")" = 70000 ] || fail "bad card out is not cut to 70000"
+cmp -n 70000 "$dir/out" "$dir/badout" ||
+  fail "bad card out differs from out before the bad card"
+
+cp "$dir/bad" "$dir/badplace"
+"$tool" --scramble --key="$dir/key" "$dir/badplace" 2>/dev/null
+[ $? = 2 ] || fail "bad card in place did not exit 2"
+cmp "$dir/bad" "$dir/badplace" || fail "bad card in place changed the input"
+
+exit 0
@@ -1,4 +1,70 @@
-#if 0
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <time.h>
+#include <assert.h>
+#include <arpa/inet.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+#include "facts.h"
+#include "spider_cipher_rank.h"
+
+//
+// Big facts: the deck set and neighborhood collision searches.  They
+// run for minutes to days, so they have their own optimized build
+// (make big) apart from the core facts.
+//
+// Like the core facts this uses the "private" static components of
+// the cipher.
+//
+
+#include "../src/spider_cipher_core.c"
+#include "spider_cipher_core_steps.h"
+
+#define CARDS SPIDER_CIPHER_CARDS
+
+typedef SpiderCipherDeck Deck;
+typedef SpiderCipherCard Card;
+
+static const Card BACK_FRONT[CARDS] =
+  {
+   39,37,35,33,31,29,27,25,23,21,
+   19,17,15,13,11, 9, 7, 5, 3, 1,
+    0, 2, 4, 6, 8,10,12,14,16,18,
+   20,22,24,26,28,30,32,34,36,38
+  };
+
+void deckInit(Deck *deck) {
+  SpiderCipherDeckInit(deck);
+}
+
+// cut so the card at cutAt (mod CARDS) is on top.
+void deckCut(Deck *in, int cutAt, Deck *out) {
+  SpiderCipherCutDeck(in,in->cards[cutAt % CARDS],out);
+}
+
+void deckBackFrontShuffle(Deck *in, Deck *out) {
+  SpiderCipherBackFrontShuffleDeck(in,out);
+}
+
+void deckBackFrontUnshuffle(Deck *in, Deck *out) {
+  for (int i=0; i<CARDS; ++i) {
+    out->cards[BACK_FRONT[i]]=in->cards[i];
+  }
+  for (int i=0; i<CARDS; ++i) {
+    out->ats[out->cards[i]]=i;
+  }
+}
+
+void deckSwap(Deck *deck, int i, int j) {
+  Card save=deck->cards[i];
+  deck->cards[i]=deck->cards[j];
+  deck->cards[j]=save;
+  deck->ats[deck->cards[i]]=i;
+  deck->ats[deck->cards[j]]=j;
+}
 
 uint8_t PERMS1[1][1]=
   {
@@ -32,7 +98,8 @@ uint8_t PERMS4[24][4]=
 // They are otherwise not important.
 
 void Z(Deck *deck, int64_t i) {
-  Deck tmp;
+  Card *cards = deck->cards;
+  Card tmp[CARDS];
   for (int j=0; j<4; ++j) {
     int i1 = 0;
     int i2 = i % 2;
@@ -42,21 +109,19 @@ void Z(Deck *deck, int64_t i) {
     int i4 = i % 24;
     i = i/24;
     
-    tmp[10*j+0+0]=deck[10*j+0+PERMS1[i1][0]];
-    tmp[10*j+1+0]=deck[10*j+1+PERMS2[i2][0]];
-    tmp[10*j+1+1]=deck[10*j+1+PERMS2[i2][1]];
-    tmp[10*j+3+0]=deck[10*j+3+PERMS3[i3][0]];
-    tmp[10*j+3+1]=deck[10*j+3+PERMS3[i3][1]];
-    tmp[10*j+3+2]=deck[10*j+3+PERMS3[i3][2]];  
-    tmp[10*j+6+0]=deck[10*j+6+PERMS4[i4][0]];
-    tmp[10*j+6+1]=deck[10*j+6+PERMS4[i4][1]];
-    tmp[10*j+6+2]=deck[10*j+6+PERMS4[i4][2]];
-    tmp[10*j+6+3]=deck[10*j+6+PERMS4[i4][3]];
+    tmp[10*j+0+0]=cards[10*j+0+PERMS1[i1][0]];
+    tmp[10*j+1+0]=cards[10*j+1+PERMS2[i2][0]];
+    tmp[10*j+1+1]=cards[10*j+1+PERMS2[i2][1]];
+    tmp[10*j+3+0]=cards[10*j+3+PERMS3[i3][0]];
+    tmp[10*j+3+1]=cards[10*j+3+PERMS3[i3][1]];
+    tmp[10*j+3+2]=cards[10*j+3+PERMS3[i3][2]];  
+    tmp[10*j+6+0]=cards[10*j+6+PERMS4[i4][0]];
+    tmp[10*j+6+1]=cards[10*j+6+PERMS4[i4][1]];
+    tmp[10*j+6+2]=cards[10*j+6+PERMS4[i4][2]];
+    tmp[10*j+6+3]=cards[10*j+6+PERMS4[i4][3]];
   }
 
-  for (int k=0; k<CARDS; ++k) {
-    deck[k]=tmp[k];
-  }
+  SpiderCipherDeckInitFromArray(deck,tmp);
 }
 
 FACTS(Z) {
@@ -72,11 +137,11 @@ FACTS(Z) {
 	  }
 
 	  Deck d0,d1;
-	  deckInit(d0);
-	  deckInit(d1);	    
-	  Z(d0,k0);
-	  Z(d1,k1);
-	  FACT(memcmp(d0,d1,CARDS)!=0,==,k0!=k1);
+	  deckInit(&d0);
+	  deckInit(&d1);
+	  Z(&d0,k0);
+	  Z(&d1,k1);
+	  FACT(memcmp(d0.cards,d1.cards,CARDS)!=0,==,k0!=k1);
 	    
 	  int b0[40],b1[40];
 	  for (int i=0; i<CARDS; ++i) {
@@ -84,12 +149,10 @@ FACTS(Z) {
 	    b1[i]=0;
 	  }
 	  for (int i=0; i<CARDS; ++i) {
-	    FACT(0,<=,d0[i]);
-	    FACT(d0[i],<,CARDS);
-	    FACT(0,<=,d1[i]);
-	    FACT(d1[i],<,CARDS);
-	    ++b0[d0[i]];
-	    ++b1[d1[i]];
+	    FACT(d0.cards[i],<,CARDS);
+	    FACT(d1.cards[i],<,CARDS);
+	    ++b0[d0.cards[i]];
+	    ++b1[d1.cards[i]];
 	  }
 	  for (int i=0; i<CARDS; ++i) {
 	    FACT(b0[i],==,1);
@@ -101,208 +164,459 @@ FACTS(Z) {
   }  
 }
 
+//
+// A DeckSet holds decks as KEY byte ranks (SpiderCipherRank, half
+// the bytes of the cards, in the same order), in bins by the top
+// bits of the rank: about as many bins as there are pbins card
+// prefixes.
+//
+// Decks are added in one pass by any number of threads, each to its
+// own shard, and go by the top SPILL_BITS of their bin to one spill
+// per shard: a growing RAM buffer in memory (file == NULL), else a
+// DECK_SET_SPILL_DECKS buffer appended a block at a time to a spill
+// tmpfile shared by the shards (the only lock).
+//
+// DeckSetSort then takes a spill at a time (all its shards, or the
+// whole tmpfile), counts and places its decks by bin, and sorts and
+// dedups the bins where they land.  In memory they land in keys (so
+// adding needs about twice the RAM of the decks); external they are
+// written in order to file (so a spill needs about twice its size of
+// RAM) and DeckSetContains reads one bin with one seek.  All disk
+// I/O is sequential but those lookups.
+//
+// Bins are sorted by keySort (an MSD radix sort that drops dups as
+// it goes) on one thread per cpu, each taking DECK_SET_SORT_CHUNK
+// bins at a time.
+//
+
+#define KEY SPIDER_CIPHER_RANK_BYTES
+
+// decks buffered per external spill.
+#define DECK_SET_SPILL_DECKS 4096
+#define DECK_SET_SPILL_BITS 6
+#define DECK_SET_SPILLS (1 << DECK_SET_SPILL_BITS)
+// bins a sorting thread takes at a time.
+#define DECK_SET_SORT_CHUNK 64
+// keys fewer than this are insertion sorted.
+#define KEY_SORT_SMALL 32
+
+typedef uint8_t Key[KEY];
+
+// one adding thread's keys by spill.
+typedef struct {
+  uint8_t *keys[DECK_SET_SPILLS];
+  uint64_t counts[DECK_SET_SPILLS];
+  uint64_t sizes[DECK_SET_SPILLS];
+} DeckSetShard;
+
 typedef struct {
   int pbins;
+  // 2^bits bins.
+  int bits;
   uint32_t nbins;
   uint32_t *counts;
-  uint32_t *offsets;
-  Card *cards;
+  // offsets[k] - end of bin k (its start is offsets[k-1]).
+  uint64_t *offsets;
+  uint8_t *keys;
   FILE *file;
+  int shardCount;
+  DeckSetShard *shards;
+  // spills by the top bits of the bin, external only but spillBits.
+  int spillBits;
+  FILE *spills[DECK_SET_SPILLS];
+  uint64_t spillCounts[DECK_SET_SPILLS];
+  pthread_mutex_t spillLocks[DECK_SET_SPILLS];
 } DeckSet;
 
-void DeckSetInit(DeckSet *me, int pbins, FILE *file) {
-  me->pbins = pbins;
-  me->nbins = 1;
+static uint32_t DeckSetBin(DeckSet *me, const uint8_t *key) {
+  uint32_t top = (uint32_t) key[0] << 24 | (uint32_t) key[1] << 16 | (uint32_t) key[2] << 8 | key[3];
+  return top >> (32-me->bits);
+}
+
+static int DeckSetSpillOf(DeckSet *me, uint32_t k) {
+  return k >> (me->bits-me->spillBits);
+}
+
+// shards - how many threads add at once.
+void DeckSetInit(DeckSet *me, int pbins, FILE *file, int shards) {
+  // the most bins, up to CARDS^pbins.
+  uint64_t prefixes = 1;
   for (int i=0; i<pbins; ++i) {
-    me->nbins  *= CARDS;
+    prefixes *= CARDS;
   }
+  me->pbins = pbins;
+  me->bits = 0;
+  while (me->bits < 32 && (((uint64_t) 2) << me->bits) <= prefixes) {
+    ++me->bits;
+  }
+  me->nbins = ((uint32_t) 1) << me->bits;
+  me->spillBits = me->bits < DECK_SET_SPILL_BITS ? me->bits : DECK_SET_SPILL_BITS;
 
   me->counts = (uint32_t*)calloc(sizeof(uint32_t),me->nbins);
-  me->offsets = (uint32_t*)calloc(sizeof(uint32_t),me->nbins);
-  me->cards = NULL;
+  me->offsets = (uint64_t*)calloc(sizeof(uint64_t),me->nbins);
+  me->shards = (DeckSetShard*)calloc(sizeof(DeckSetShard),shards);
+  assert(me->counts != NULL && me->offsets != NULL && me->shards != NULL);
+  me->shardCount = shards;
+  me->keys = NULL;
   me->file = file;
+  for (int s=0; s<DECK_SET_SPILLS; ++s) {
+    me->spills[s] = NULL;
+    me->spillCounts[s] = 0;
+  }
+  if (file != NULL) {
+    for (int s=0; s < (1 << me->spillBits); ++s) {
+      me->spills[s] = tmpfile();
+      assert(me->spills[s] != NULL);
+      pthread_mutex_init(&me->spillLocks[s],NULL);
+    }
+  }
 }
 
-void DeckSetCount(DeckSet *me, Deck deck) {
-  int k=0;
-  for (int i=0; i<me->pbins; ++i) {
-    k=CARDS*k+deck[i];
-  }
-  ++me->counts[k];
+// append shard's buffer of spill s to the spill tmpfile.
+static void DeckSetSpill(DeckSet *me, DeckSetShard *shard, int s) {
+  size_t n = shard->counts[s];
+  if (n == 0) return;
+  pthread_mutex_lock(&me->spillLocks[s]);
+  size_t writeOk = fwrite(shard->keys[s],KEY,n,me->spills[s]);
+  me->spillCounts[s] += n;
+  pthread_mutex_unlock(&me->spillLocks[s]);
+  assert(writeOk==n);
+  shard->counts[s] = 0;
 }
 
-void DeckSetCounted(DeckSet *me) {
-  for (int i=0; i<me->nbins; ++i) {
-    me->offsets[i] = ((i > 0) ? me->offsets[i-1] : 0) + me->counts[i];
+// Only one thread at a time per shard.
+void DeckSetAdd(DeckSet *me, int shardAt, Deck *deck) {
+  DeckSetShard *shard = &me->shards[shardAt];
+  Key key;
+  SpiderCipherRank(deck,key);
+  int s = DeckSetSpillOf(me,DeckSetBin(me,key));
+  if (shard->counts[s] == shard->sizes[s]) {
+    if (me->file != NULL && shard->sizes[s] > 0) {
+      DeckSetSpill(me,shard,s);
+    } else {
+      uint64_t size = me->file != NULL ? DECK_SET_SPILL_DECKS
+	: shard->sizes[s] > 0 ? 2*shard->sizes[s] : DECK_SET_SPILL_DECKS;
+      shard->keys[s] = (uint8_t*) realloc(shard->keys[s],size*KEY);
+      assert(shard->keys[s] != NULL);
+      shard->sizes[s] = size;
+    }
   }
-  if (me->file == NULL) {
-    me->cards = (Card*) calloc(me->offsets[me->nbins-1],CARDS);
-    assert(me->cards != NULL);
+  memcpy(shard->keys[s]+shard->counts[s]*KEY,key,KEY);
+  ++shard->counts[s];
+}
+
+int keyComp(const uint8_t *a, const uint8_t *b) {
+  return memcmp(a,b,KEY);
+}
+
+// insertion sort of n keys (equal before byte depth), dropping dups,
+// the count kept.
+static uint32_t keySortSmall(uint8_t *keys, uint32_t n, int depth) {
+  Key key;
+  uint32_t kept = 0;
+  for (uint32_t i=0; i<n; ++i) {
+    memcpy(key,keys+i*KEY,KEY);
+    uint32_t j = kept;
+    int cmp = 1;
+    while (j > 0) {
+      cmp = memcmp(keys+(j-1)*KEY+depth,key+depth,KEY-depth);
+      if (cmp <= 0) break;
+      --j;
+    }
+    if (j > 0 && cmp == 0) continue;
+    memmove(keys+(j+1)*KEY,keys+j*KEY,(kept-j)*KEY);
+    memcpy(keys+j*KEY,key,KEY);
+    ++kept;
   }
-  memset(me->counts,0,me->nbins*sizeof(uint32_t));  
+  return kept;
 }
 
-void DeckSetSave(DeckSet *me) {
-  if (me->file == NULL) return;
-  
-  int seekOk = fseek(me->file,0L,SEEK_SET);
-  assert(seekOk==0);
-  for (int i=0; i<me->nbins; ++i) {
-    me->counts[i]=htonl(me->counts[i]);
+//
+// MSD radix sort of n keys (equal before byte depth), a counting
+// pass per byte through tmp (n keys), dropping dups: each bucket's
+// kept keys move down over the dups before it.  The count kept.
+//
+static uint32_t keySort(uint8_t *keys, uint8_t *tmp, uint32_t n, int depth) {
+  uint32_t counts[256];
+  for (;;) {
+    if (n < KEY_SORT_SMALL) return keySortSmall(keys,n,depth);
+    if (depth == KEY) return 1;
+
+    memset(counts,0,sizeof(counts));
+    for (uint32_t i=0; i<n; ++i) {
+      ++counts[keys[i*KEY+depth]];
+    }
+    // a byte every key shares needs no pass.
+    if (counts[keys[depth]] == n) {
+      ++depth;
+      continue;
+    }
+    break;
   }
-  for (int i=0; i<me->nbins; ++i) {
-    me->offsets[i]=htonl(me->offsets[i]);
+
+  uint32_t starts[256];
+  uint32_t at = 0;
+  for (int b=0; b<256; ++b) {
+    starts[b] = at;
+    at += counts[b];
   }
-  int writeOk = fwrite(me->counts,sizeof(uint32_t),me->nbins,me->file);
-  assert(writeOk==me->nbins);
-  writeOk = fwrite(me->offsets,sizeof(uint32_t),me->nbins,me->file);
-  assert(writeOk==me->nbins);
-  for (int i=0; i<me->nbins; ++i) {
-    me->counts[i]=ntohl(me->counts[i]);
+  for (uint32_t i=0; i<n; ++i) {
+    memcpy(tmp+(starts[keys[i*KEY+depth]]++)*KEY,keys+i*KEY,KEY);
   }
-  for (int i=0; i<me->nbins; ++i) {
-    me->offsets[i]=ntohl(me->offsets[i]);
+  memcpy(keys,tmp,(size_t) n*KEY);
+
+  uint32_t kept = 0;
+  at = 0;
+  for (int b=0; b<256; ++b) {
+    if (counts[b] == 0) continue;
+    uint32_t k = keySort(keys+at*KEY,tmp,counts[b],depth+1);
+    if (kept != at) memmove(keys+kept*KEY,keys+at*KEY,k*KEY);
+    kept += k;
+    at += counts[b];
   }
+  return kept;
 }
 
-void DeckSetLoad(DeckSet *me) {
-  if (me->file == NULL) return;
-  int seekOk = fseek(me->file,0L,SEEK_SET);
-  assert(seekOk==0);
-  int readOk = fread(me->counts,sizeof(uint32_t),me->nbins,me->file);
-  assert(readOk==me->nbins);
-  readOk = fread(me->offsets,sizeof(uint32_t),me->nbins,me->file);
-  assert(readOk==me->nbins);
+static int cpus() {
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  return n > 0 ? (int) n : 1;
+}
 
-  for (int i=0; i<me->nbins; ++i) {
-    me->counts[i]=ntohl(me->counts[i]);
+// run work(arg) on a thread per cpu (at most most, at least 1), the
+// caller being one of them.
+static void parallel(void *(*work)(void *), void *arg, uint32_t most) {
+  int threads = cpus();
+  if ((uint32_t) threads > most) threads = most > 0 ? (int) most : 1;
+  pthread_t *workers = (pthread_t*) malloc(threads*sizeof(pthread_t));
+  assert(workers != NULL);
+  for (int t=1; t<threads; ++t) {
+    int created = pthread_create(&workers[t],NULL,work,arg);
+    if (created != 0) {
+      fprintf(stderr,"parallel: pthread_create: %s\n",strerror(created));
+      exit(2);
+    }
   }
-  for (int i=0; i<me->nbins; ++i) {
-    me->offsets[i]=ntohl(me->offsets[i]);
+  work(arg);
+  for (int t=1; t<threads; ++t) {
+    pthread_join(workers[t],NULL);
   }
+  free(workers);
 }
 
-void DeckSetAdd(DeckSet *me, Deck deck) {
-  int k=0;
-  for (int i=0; i<me->pbins; ++i) {
-    k=CARDS*k+deck[i];
+//
+// Bins k0..k1-1 to sort: bin k is the counts[k] keys ending at key
+// ends[k], all equal before byte depth.
+//
+typedef struct {
+  uint8_t *keys;
+  const uint64_t *ends;
+  uint32_t *counts;
+  uint32_t k1;
+  int depth;
+  uint32_t most;
+  atomic_uint next;
+  atomic_uint_fast64_t dups;
+} DeckSetSorting;
+
+static void *DeckSetSortWork(void *arg) {
+  DeckSetSorting *sorting = (DeckSetSorting*) arg;
+  uint8_t *tmp = (uint8_t*) malloc((size_t) sorting->most*KEY+1);
+  assert(tmp != NULL);
+  uint64_t dups = 0;
+  for (;;) {
+    uint32_t k0 = atomic_fetch_add(&sorting->next,DECK_SET_SORT_CHUNK);
+    if (k0 >= sorting->k1) break;
+    uint32_t k1 = sorting->k1-k0 < DECK_SET_SORT_CHUNK ? sorting->k1 : k0+DECK_SET_SORT_CHUNK;
+    for (uint32_t k=k0; k<k1; ++k) {
+      uint32_t count = sorting->counts[k];
+      if (count < 2) continue;
+      uint8_t *keys = sorting->keys+(sorting->ends[k]-count)*KEY;
+      uint32_t kept = keySort(keys,tmp,count,sorting->depth);
+      dups += count-kept;
+      sorting->counts[k] = kept;
+    }
   }
-  uint64_t offset = ((k > 0) ? me->offsets[k-1] : 0)+me->counts[k];
-  if (me->file == NULL) {
-    memcpy(me->cards+CARDS*offset,deck,CARDS);
-  } else {
-    offset = CARDS*offset + me->nbins*sizeof(uint32_t);
-    int seekOk = fseek(me->file,offset,SEEK_SET);
-    assert(seekOk==0);
-    int writeOk = fwrite(deck,CARDS,1,me->file);
-    assert(writeOk==1);
+  free(tmp);
+  atomic_fetch_add(&sorting->dups,dups);
+  return NULL;
+}
+
+// sort and dedup bins k0..k1-1 in parallel (counts become the kept
+// counts, the kept keys start each bin), the dups dropped.
+static uint64_t DeckSetSortBins(DeckSet *me, uint8_t *keys, const uint64_t *ends,
+				uint32_t k0, uint32_t k1) {
+  DeckSetSorting sorting;
+  sorting.keys = keys;
+  sorting.ends = ends;
+  sorting.counts = me->counts;
+  sorting.k1 = k1;
+  sorting.depth = me->bits/8;
+  sorting.most = 0;
+  for (uint32_t k=k0; k<k1; ++k) {
+    if (me->counts[k] > sorting.most) sorting.most = me->counts[k];
   }
-  ++me->counts[k];
+  atomic_init(&sorting.next,k0);
+  atomic_init(&sorting.dups,0);
+
+  uint32_t chunks = (k1-k0+DECK_SET_SORT_CHUNK-1)/DECK_SET_SORT_CHUNK;
+  parallel(DeckSetSortWork,&sorting,chunks);
+  return atomic_load(&sorting.dups);
 }
 
-int deckComp(Card *a, Card *b) {
-  return memcmp(a,b,CARDS);
+// place keys[0..n-1] (of spill s) by bin in out, offsets the cursors.
+static void DeckSetPlace(DeckSet *me, const uint8_t *keys, uint64_t n, uint8_t *out) {
+  for (uint64_t i=0; i<n; ++i) {
+    uint32_t k = DeckSetBin(me,keys+i*KEY);
+    memcpy(out+(me->offsets[k]++)*KEY,keys+i*KEY,KEY);
+  }
 }
 
-uint32_t unique(uint32_t n, Card *cards) {
-  uint32_t i=0,j=1;
-  while (j < n) {
-    if (memcmp(cards+i*CARDS,cards+j*CARDS,CARDS)==0) {
-      ++j;
-    } else {
-      ++i;
-      if (i != j) {
-	memcpy(cards+i*CARDS,cards+j*CARDS,CARDS);
+// seek file to key at.  Not in an assert: every read and write of
+// the external set depends on it, NDEBUG or not.
+static void keySeek(FILE *file, uint64_t at) {
+  if (fseek(file,(long) (at*KEY),SEEK_SET) != 0) {
+    perror("DeckSet fseek");
+    exit(2);
+  }
+}
+
+//
+// Sort spill s: count its keys by bin, place them by bin in out
+// starting at key base, and sort the bins there.  External, in is
+// the spill read back, and the bins are then written to file after
+// key end.  Returns the dups.
+//
+static uint64_t DeckSetSortSpill(DeckSet *me, int s, uint8_t *in, uint8_t *out,
+				 uint64_t base, uint64_t end) {
+  uint32_t bins = me->nbins >> me->spillBits;
+  uint32_t k0 = s*bins;
+  uint64_t n = me->spillCounts[s];
+  if (me->file != NULL) {
+    keySeek(me->spills[s],0);
+    size_t readOk = fread(in,KEY,n,me->spills[s]);
+    assert(readOk==n);
+    fclose(me->spills[s]);
+    me->spills[s] = NULL;
+    for (uint64_t i=0; i<n; ++i) {
+      ++me->counts[DeckSetBin(me,in+i*KEY)];
+    }
+  } else {
+    for (int t=0; t<me->shardCount; ++t) {
+      DeckSetShard *shard = &me->shards[t];
+      for (uint64_t i=0; i<shard->counts[s]; ++i) {
+	++me->counts[DeckSetBin(me,shard->keys[s]+i*KEY)];
       }
-      ++j;
     }
   }
-  return i+1;
-}
 
-uint32_t DeckSetSort(DeckSet *me) {
-  uint32_t dups  = 0;
-  int maxCount = 0;
-  for (int k=0; k<me->nbins; ++k) {
-    if (me->counts[k] > maxCount) maxCount = me->counts[k];
+  // place decks by bin, then sort the bins where they land.
+  uint64_t at = base;
+  for (uint32_t k=k0; k<k0+bins; ++k) {
+    me->offsets[k] = at;
+    at += me->counts[k];
   }
+  if (me->file != NULL) {
+    DeckSetPlace(me,in,n,out);
+  } else {
+    for (int t=0; t<me->shardCount; ++t) {
+      DeckSetShard *shard = &me->shards[t];
+      DeckSetPlace(me,shard->keys[s],shard->counts[s],out);
+      free(shard->keys[s]);
+      shard->keys[s] = NULL;
+      shard->counts[s] = shard->sizes[s] = 0;
+    }
+  }
+  uint64_t dups = DeckSetSortBins(me,out,me->offsets,k0,k0+bins);
+  if (me->file == NULL) return dups;
+
+  // offsets turn from ends in out to ends in file.
+  uint64_t start = 0;
+  for (uint32_t k=k0; k<k0+bins; ++k) {
+    uint32_t kept = me->counts[k];
+    size_t writeOk = fwrite(out+start*KEY,KEY,kept,me->file);
+    assert(writeOk==kept);
+    start = me->offsets[k];
+    end += kept;
+    me->offsets[k] = end;
+  }
+  return dups;
+}
+
+uint64_t DeckSetSort(DeckSet *me) {
+  int spills = 1 << me->spillBits;
+  uint32_t bins = me->nbins >> me->spillBits;
+  uint64_t dups = 0;
 
-  if (maxCount < 2) {
+  if (me->file == NULL) {
+    uint64_t n = 0;
+    for (int s=0; s<spills; ++s) {
+      for (int t=0; t<me->shardCount; ++t) {
+	me->spillCounts[s] += me->shards[t].counts[s];
+      }
+      n += me->spillCounts[s];
+    }
+    me->keys = (uint8_t*) malloc(n*KEY+1);
+    assert(me->keys != NULL);
+    uint64_t base = 0;
+    for (int s=0; s<spills; ++s) {
+      dups += DeckSetSortSpill(me,s,NULL,me->keys,base,0);
+      base += me->spillCounts[s];
+    }
     return dups;
   }
 
-  Card *cards = NULL;
-  if (me->file != NULL) {
-    cards = (Card*) malloc(CARDS*maxCount);
-    assert(cards != NULL);
-  }
-  
-  for (int k=0; k<me->nbins; ++k) {
-    if (me->counts[k] < 2) continue;
-    uint64_t offset = ((k > 0) ? me->offsets[k-1] : 0);
-    if (me->file == NULL) {
-      qsort(me->cards+CARDS*offset,me->counts[k],CARDS,
-	    (int (*)(const void *, const void *))deckComp);
-      uint32_t count=unique(me->counts[k],me->cards+CARDS*offset);
-      dups += (me->counts[k]-count);
-      me->counts[k]=count;
-    } else {
-      offset = CARDS*offset + me->nbins*sizeof(uint32_t);
-      int seekOk = fseek(me->file,offset,SEEK_SET);
-      assert(seekOk==0);
-      int readOk = fread(cards,CARDS,me->counts[k],me->file);
-      assert(readOk==me->counts[k]);
-      qsort(cards,me->counts[k],CARDS,
-	    (int (*)(const void *, const void *))deckComp);
-      uint32_t count=unique(me->counts[k],cards);      
-      dups += (me->counts[k]-count);
-      me->counts[k]=count;
-      seekOk = fseek(me->file,offset,SEEK_SET);
-      assert(seekOk==0);    
-      int writeOk = fwrite(cards,CARDS,me->counts[k],me->file);
-      assert(writeOk==me->counts[k]);
+  uint64_t maxSpill = 0;
+  for (int s=0; s<spills; ++s) {
+    for (int t=0; t<me->shardCount; ++t) {
+      DeckSetShard *shard = &me->shards[t];
+      DeckSetSpill(me,shard,s);
+      free(shard->keys[s]);
+      shard->keys[s] = NULL;
+      shard->sizes[s] = 0;
     }
+    if (me->spillCounts[s] > maxSpill) maxSpill = me->spillCounts[s];
   }
-  
-  free(cards);
 
+  uint8_t *in = (uint8_t*) malloc(maxSpill*KEY+1);
+  uint8_t *out = (uint8_t*) malloc(maxSpill*KEY+1);
+  assert(in != NULL && out != NULL);
+  keySeek(me->file,0);
+  uint64_t end = 0;
+  for (int s=0; s<spills; ++s) {
+    dups += DeckSetSortSpill(me,s,in,out,0,end);
+    end = me->offsets[(s+1)*bins-1];
+  }
+  fflush(me->file);
+  free(in);
+  free(out);
   return dups;
-  
 }
 
 void DeckSetClose(DeckSet *me) {
-  DeckSetSave(me);
-  free(me->cards);
+  for (int s=0; s<DECK_SET_SPILLS; ++s) {
+    if (me->spills[s] != NULL) fclose(me->spills[s]);
+  }
+  if (me->file != NULL) {
+    for (int s=0; s < (1 << me->spillBits); ++s) {
+      pthread_mutex_destroy(&me->spillLocks[s]);
+    }
+  }
+  for (int t=0; t<me->shardCount; ++t) {
+    for (int s=0; s<DECK_SET_SPILLS; ++s) {
+      free(me->shards[t].keys[s]);
+    }
+  }
+  free(me->shards);
+  free(me->keys);
   free(me->counts);
   free(me->offsets);
 }
 
-
-int DeckSetContains(DeckSet *me, Deck deck) {
-  int k=0;
-  for (int i=0; i<me->pbins; ++i) {
-    k = CARDS*k + deck[i];
-  }
-  if (me->counts[k] == 0) return 0;
-
-  int64_t lo = ((k > 0) ? ((int64_t)me->offsets[k-1]) : ((int64_t)0))  - 1;
-  int64_t hi = lo + me->counts[k] + 1;
-
+static int DeckSetSearch(const uint8_t *keys, uint32_t n, const uint8_t *key) {
+  int64_t lo = -1, hi = n;
   while (hi-lo >= 2) {
     int64_t mid = (lo+hi)/2;
-    Deck tmp;
-    uint64_t offset = mid;
-    int cmp = 0;
-    if (me->file == NULL) {
-      cmp=deckComp(deck,me->cards+offset*CARDS);
-    } else {
-      offset = CARDS*offset + me->nbins*sizeof(uint32_t);
-      int seekOk = fseek(me->file,offset,SEEK_SET);
-      assert(seekOk==0);
-      int readOk = fread(tmp,CARDS,1,me->file);
-      assert(readOk==1);
-      cmp = deckComp(deck,tmp);
-    }
+    int cmp = keyComp(key,keys+mid*KEY);
     if (cmp == 0) return 1;
     if (cmp < 0) {
       hi = mid;
@@ -313,6 +627,28 @@ int DeckSetContains(DeckSet *me, Deck deck) {
   return 0;
 }
 
+int DeckSetContains(DeckSet *me, Deck *deck) {
+  Key key;
+  SpiderCipherRank(deck,key);
+  uint32_t k=DeckSetBin(me,key);
+  uint32_t n=me->counts[k];
+  if (n == 0) return 0;
+  uint64_t offset = (k > 0) ? me->offsets[k-1] : 0;
+
+  if (me->file == NULL) {
+    return DeckSetSearch(me->keys+offset*KEY,n,key);
+  }
+
+  uint8_t *keys = (uint8_t*) malloc((size_t) n*KEY);
+  assert(keys != NULL);
+  keySeek(me->file,offset);
+  size_t readOk = fread(keys,KEY,n,me->file);
+  assert(readOk==n);
+  int found = DeckSetSearch(keys,n,key);
+  free(keys);
+  return found;
+}
+
 FACTS(DeckSet) {
   for (int tmp = 0; tmp<2; ++tmp) {
     for (int pbins = 1; pbins < 4; ++pbins) {
@@ -324,37 +660,20 @@ FACTS(DeckSet) {
 	file=tmpfile();
 	assert(file != NULL);
       }
-      DeckSetInit(ds,pbins,file);
-
-      for (int64_t j=0; j<1; ++j) {
-	for (int64_t i=0; i<2*6*24; ++i) {
-	  int64_t k = i+((j>0) ? pow(2*6*24,j) : 0);
-
-	  if (k % 17 == 0) continue;
-	  Deck deck;
-
-	  deckInit(deck);
-	  Z(deck,k);
-	  DeckSetCount(ds,deck);
-	  if (k % 19 == 0 && j == 0 && i < 100) {
-	    DeckSetCount(ds,deck);
-	    ++dups;
-	  }
-	}
-      }
-
-      DeckSetCounted(ds);
+      // two shards, a deck's dup in the other one.
+      DeckSetInit(ds,pbins,file,2);
 
       for (int64_t j=0; j<1; ++j) {
 	for (int64_t i=2*6*24-1; i>=0; --i) {
 	  int64_t k = i+((j>0) ? pow(2*6*24,j) : 0);
 	  if (k % 17 == 0) continue;
 	  Deck deck;
-	  deckInit(deck);
-	  Z(deck,k);
-	  DeckSetAdd(ds,deck);
+	  deckInit(&deck);
+	  Z(&deck,k);
+	  DeckSetAdd(ds,i % 2,&deck);
 	  if (k % 19 == 0 && j == 0 && i < 100) {
-	    DeckSetAdd(ds,deck);
+	    DeckSetAdd(ds,(i+1) % 2,&deck);
+	    ++dups;
 	  }
 	}
       }
@@ -365,9 +684,9 @@ FACTS(DeckSet) {
 	for (int64_t i=0; i<2*6*24; ++i) {
 	  int64_t k = i+((j>0) ? pow(2*6*24,j) : 0);
 	  Deck deck;
-	  deckInit(deck);
-	  Z(deck,k);
-	  int ans = DeckSetContains(ds,deck);
+	  deckInit(&deck);
+	  Z(&deck,k);
+	  int ans = DeckSetContains(ds,&deck);
 	  FACT(ans,==,k % 17 != 0);
 	}
       }
@@ -375,6 +694,7 @@ FACTS(DeckSet) {
       FACT(dups,==,dups2);
 
       DeckSetClose(ds);
+      free(ds);
       if (file != NULL) {
 	fclose(file);
       }
@@ -382,45 +702,135 @@ FACTS(DeckSet) {
   }
 }
 
-void Neighbors(DeckSet *ds,Deck deck, int perfect, int dir, int dist, int count, double *progress, double done) {
+// keySort against qsort, over sizes around KEY_SORT_SMALL and up,
+// with shared prefixes and many dups.
+FACTS(KeySort) {
+  uint32_t sizes[] = { 0, 1, 2, KEY_SORT_SMALL-1, KEY_SORT_SMALL, 1000, 100000 };
+  for (int z=0; z<(int) (sizeof(sizes)/sizeof(sizes[0])); ++z) {
+    uint32_t n = sizes[z];
+    uint8_t *keys = (uint8_t*) malloc((size_t) n*KEY+1);
+    uint8_t *expect = (uint8_t*) malloc((size_t) n*KEY+1);
+    uint8_t *tmp = (uint8_t*) malloc((size_t) n*KEY+1);
+    assert(keys != NULL && expect != NULL && tmp != NULL);
+    for (uint32_t i=0; i<n; ++i) {
+      // bytes 0..2 shared, then few values so keys often tie.
+      for (int b=0; b<KEY; ++b) {
+	keys[i*KEY+b] = b < 3 ? 7 : FactsRandomRange(b < KEY-2 ? 3 : 256);
+      }
+    }
+    memcpy(expect,keys,(size_t) n*KEY);
+    qsort(expect,n,KEY,(int (*)(const void *, const void *))keyComp);
+    uint32_t kept = 0;
+    for (uint32_t i=0; i<n; ++i) {
+      if (kept == 0 || keyComp(expect+(kept-1)*KEY,expect+i*KEY) != 0) {
+	memmove(expect+kept*KEY,expect+i*KEY,KEY);
+	++kept;
+      }
+    }
+
+    FACT(keySort(keys,tmp,n,0),==,kept);
+    FACT(memcmp(keys,expect,(size_t) kept*KEY),==,0);
+    free(keys);
+    free(expect);
+    free(tmp);
+  }
+}
+
+// the c-th neighbor of deck: cut at c then back-front shuffle
+// (dir 1), or its inverse.
+void neighbor(Deck *deck, int c, int perfect, int dir, Deck *next) {
+  Deck tmp;
+  if (dir == 1) {
+    deckCut(deck,c,&tmp);
+    deckBackFrontShuffle(&tmp,next);
+    if (perfect) {
+      deckSwap(next,0,19);
+    }
+  } else {
+    SpiderCipherCopyDeck(deck,next);
+    if (perfect) {
+      deckSwap(next,0,19);
+    }
+    deckBackFrontUnshuffle(next,&tmp);
+    deckCut(&tmp,CARDS-c,next);
+  }
+}
+
+void Neighbors(DeckSet *ds, int shard, Deck *deck, int perfect, int dir, int dist) {
   if (dist > 0) {
-    Deck tmp,next;
+    Deck next;
     for (int c=0; c<CARDS; ++c) {
-      if (dir == 1) {
-	deckCut(deck,c,tmp);
-	deckBackFrontShuffle(tmp,next);
-	if (perfect) {
-	  int save=next[19];
-	  next[19]=next[0];
-	  next[0]=save;
-	}
-      } else {
-	for (int d=0; d<CARDS; ++d) {
-	  next[d]=deck[d];
-	}
-	if (perfect) {
-	  int save=next[19];
-	  next[19]=next[0];
-	  next[0]=save;
-	}
-        deckBackFrontUnshuffle(next,tmp);
-	deckCut(tmp,CARDS-c,next);
-      }
+      neighbor(deck,c,perfect,dir,&next);
+      DeckSetAdd(ds,shard,&next);
+      Neighbors(ds,shard,&next,perfect,dir,dist-1);
+    }
+  }
+}
 
-      if (progress != NULL) {
-	if (floor((*progress*20)/done) != floor(((*progress+1)*20)/done)) {
-	  fprintf(stderr,"%0.1f done.\n",((*progress)*100)/done);
-	}
-	*progress += 1.0;
-      }
-      if (count) {
-	DeckSetCount(ds,next);
-      } else {
-	DeckSetAdd(ds,next);
-      }
-      Neighbors(ds,next,perfect,dir,dist-1,count,progress,done);
+// the first levels of the neighborhood split into CARDS^levels
+// subtrees, taken one at a time by the threads.
+#define NEIGHBORHOOD_LEVELS 2
+
+typedef struct {
+  DeckSet *ds;
+  Deck deck;
+  int perfect;
+  int dir;
+  int dist;
+  int levels;
+  uint32_t subtrees;
+  atomic_uint next;
+  atomic_uint done;
+  atomic_int shards;
+} NeighborhoodSearch;
+
+static void *NeighborhoodWork(void *arg) {
+  NeighborhoodSearch *me = (NeighborhoodSearch*) arg;
+  int shard = atomic_fetch_add(&me->shards,1);
+  Deck decks[NEIGHBORHOOD_LEVELS+1];
+  for (;;) {
+    uint32_t i = atomic_fetch_add(&me->next,1);
+    if (i >= me->subtrees) break;
+    // subtree i's path, most significant card first; the decks on
+    // it are added by the first subtree under them (the rest 0).
+    decks[0] = me->deck;
+    uint32_t under = me->subtrees;
+    for (int l=0; l<me->levels; ++l) {
+      under /= CARDS;
+      neighbor(&decks[l],i/under % CARDS,me->perfect,me->dir,&decks[l+1]);
+      if (i % under == 0) DeckSetAdd(me->ds,shard,&decks[l+1]);
     }
+    Neighbors(me->ds,shard,&decks[me->levels],me->perfect,me->dir,me->dist-me->levels);
+
+    uint32_t done = atomic_fetch_add(&me->done,1)+1;
+    if (done*20/me->subtrees != (done-1)*20/me->subtrees) {
+      fprintf(stderr,"%0.1f done.\n",(done*100.0)/me->subtrees);
+    }
+  }
+  return NULL;
+}
+
+// add deck's neighbors to dist (not deck) to ds, on a thread per
+// cpu up to ds's shards.
+void Neighborhood(DeckSet *ds, Deck *deck, int perfect, int dir, int dist) {
+  NeighborhoodSearch me;
+  me.ds = ds;
+  me.deck = *deck;
+  me.perfect = perfect;
+  me.dir = dir;
+  me.dist = dist;
+  me.levels = dist < NEIGHBORHOOD_LEVELS ? dist : NEIGHBORHOOD_LEVELS;
+  me.subtrees = 1;
+  for (int l=0; l<me.levels; ++l) {
+    me.subtrees *= CARDS;
   }
+  atomic_init(&me.next,0);
+  atomic_init(&me.done,0);
+  atomic_init(&me.shards,0);
+  if (dist == 0) return;
+  // pick the engine before any thread races to do it.
+  SpiderCipherEngine();
+  parallel(NeighborhoodWork,&me,ds->shardCount);
 }
 
 double timer() {
@@ -438,34 +848,24 @@ void datetime(double timer) {
   fprintf(stderr,"%s.%09ld UTC\n",buff,ts.tv_nsec);
 }
 
-int dups(int perfect, int dir, int dist) {
+// collisions in the neighborhood, external (on disk) or in memory.
+int dupsBy(int perfect, int dir, int dist, int external) {
   Deck deck;
-  deckInit(deck);
+  deckInit(&deck);
 
-  FILE *file = dist > 5 ? tmpfile() : NULL;
+  FILE *file = external ? tmpfile() : NULL;
   int pbins = dist > 5 ? 5 : 4;
 
   DeckSet *ds = (DeckSet*) malloc(sizeof(DeckSet));
-  DeckSetInit(ds,pbins,file);
+  DeckSetInit(ds,pbins,file,cpus());
 
-  int count = 1;
-  double progress = 0;
   double done = (pow((double)CARDS,(double)(dist+1))-1)/(CARDS-1);
 
   fprintf(stderr,"%f steps.\n",done);
-  fprintf(stderr,"counting deck bins in neighborhood.\n");
-  double t0=timer();
-  datetime(t0);
-  Neighbors(ds,deck,perfect,dir,dist,count,&progress,done);
-  DeckSetCounted(ds);
   double t1=timer();
   datetime(t1);
-  fprintf(stderr,"counting took %f seconds\n",t1-t0);
-  
-  count = 0;
-  progress = 0;
   fprintf(stderr,"adding decks to neighborhood.\n");
-  Neighbors(ds,deck,perfect,dir,dist,count,&progress,done);
+  Neighborhood(ds,&deck,perfect,dir,dist);
   double t2=timer();
   datetime(t2);
   fprintf(stderr,"adding took %f seconds\n",t2-t1);
@@ -483,6 +883,10 @@ int dups(int perfect, int dir, int dist) {
   return dups;
 }
 
+int dups(int perfect, int dir, int dist) {
+  return dupsBy(perfect,dir,dist,dist > 5);
+}
+
 FACTS(Neighborhood4) {
   int perfect = 0;
   int n = 4;
@@ -490,6 +894,13 @@ FACTS(Neighborhood4) {
   FACT(collisions,==,0);
 }
 
+FACTS(ExternalNeighborhood4) {
+  int perfect = 0;
+  int external = 1;
+  int collisions = dupsBy(perfect,1,4,external);
+  FACT(collisions,==,0);
+}
+
 FACTS(PerfectNeighborhood4) {
   int perfect = 1;
   int dir = 1;
@@ -498,7 +909,8 @@ FACTS(PerfectNeighborhood4) {
   FACT(collisions,==,0);
 }
 
-// About 200GB disk space, 10GB RAM, and a WEEK of runtime...
+// About 85GB disk space (twice that while sorting), 10GB RAM, and
+// hours of (disk bound) runtime...
 FACTS_EXCLUDE(Neighborhood6) {
   int perfect = 0;
   int dir = 1;
@@ -507,7 +919,8 @@ FACTS_EXCLUDE(Neighborhood6) {
   FACT(collisions,==,0);
 }
 
-// About 200GB disk space, 10GB RAM, and a WEEK of runtime...
+// About 85GB disk space (twice that while sorting), 10GB RAM, and
+// hours of (disk bound) runtime...
 FACTS_EXCLUDE(PerfectNeighborhood6) {
   int perfect = 1;
   int dir = 1;
@@ -516,48 +929,16 @@ FACTS_EXCLUDE(PerfectNeighborhood6) {
   FACT(collisions,==,0);
 }
 
+// explicit, the optimized (LTO) build may miss auto facts.
 FACTS_REGISTER_ALL() {
-    FACTS_REGISTER(RandStats);
-    FACTS_REGISTER(FaceAndSuitNo);
-    FACTS_REGISTER(FaceFromNo);
-    FACTS_REGISTER(SuitFromNo);
-    FACTS_REGISTER(CardFromFaceSuitNo);
-    FACTS_REGISTER(Add);
-    FACTS_REGISTER(Subtract);
-    FACTS_REGISTER(Init);
-    FACTS_REGISTER(Cut);
-    FACTS_REGISTER(BackFrontShuffle);
-    FACTS_REGISTER(FindCard);
-    FACTS_REGISTER(PseudoShuffle);
-    FACTS_REGISTER(Pads);
-    FACTS_REGISTER(Ciphers);
-    FACTS_REGISTER(Encode);
-    FACTS_REGISTER(Envelope);
-    FACTS_REGISTER(BackFrontUnshuffle);
-    FACTS_REGISTER(P);
-    FACTS_REGISTER(PReachable);
-    FACTS_REGISTER(I);
-    FACTS_REGISTER(IReachable);
-    FACTS_REGISTER(Q);
-    FACTS_REGISTER(QReachable);
-    FACTS_REGISTER(T);
-    FACTS_REGISTER(TReachable);
-    FACTS_REGISTER(R);
-    FACTS_REGISTER(RReachable);
-    FACTS_REGISTER(X);
-    FACTS_REGISTER(XReachable);
-    FACTS_REGISTER(B);
-    FACTS_REGISTER(BReachable);
-    FACTS_REGISTER(S);
-    FACTS_REGISTER(SReachable);
-    FACTS_REGISTER(Cycles);
-    FACTS_REGISTER(InverseCycles);
     FACTS_REGISTER(Z);
     FACTS_REGISTER(DeckSet);
+    FACTS_REGISTER(KeySort);
     FACTS_REGISTER(Neighborhood4);
+    FACTS_REGISTER(ExternalNeighborhood4);
     FACTS_REGISTER(PerfectNeighborhood4);
     FACTS_REGISTER(Neighborhood6);
     FACTS_REGISTER(PerfectNeighborhood6);
 }
 
-#endif
+FACTS_MAIN
@@ -15,6 +15,8 @@
 //
 
 #include "../src/spider_cipher_core.c"
+#include "spider_cipher_core_steps.h"
+#include "spider_cipher_samples.h"
 
 #define CARDS SPIDER_CIPHER_CARDS
 #define CUT_ZTH 0
@@ -24,17 +26,6 @@
 typedef SpiderCipherDeck Deck;
 typedef SpiderCipherCard Card;
 
-void deckOk(Deck *deck) {
-  for (uint8_t i=0; i<CARDS; ++i) {
-    assert(deck->ats[i] < CARDS);
-    assert(deck->cards[i] < CARDS);
-  }
-  for (uint8_t i=0; i<CARDS; ++i) {
-    assert(deck->cards[deck->ats[i]]==i);
-    assert(deck->ats[deck->cards[i]]==i);    
-  }
-}
-
 int cardsCmp(int n,Card *a, Card *b) {
   for (int i=0; i<n; ++i) {
     if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
@@ -42,12 +33,6 @@ int cardsCmp(int n,Card *a, Card *b) {
   return 0;
 }
 
-int deckCmp(Deck *a, Deck *b) {
-  deckOk(a);
-  deckOk(b);
-  return cardsCmp(CARDS,a->cards,b->cards);
-}
-
 void setAts(Deck *deck) {
   for (uint8_t i=0; i<CARDS; ++i) {
     deck->ats[i]=CARDS;
@@ -370,23 +355,7 @@ const Permutation BACK_FRONT = {39,37,35,33,31,29,27,25,23,21,
 void samplePermutation(Permutation p, int a,int b) {
   assert(a > 0 && a < 41);
   assert(b >= 0 && b < 41);
-  int skip=0;
-  
-  // <= is ok here: 1 case is always skipped
-  for (int at=0; at<=CARDS; ++at) {
-    //
-    // Because 41 is prime x is guaranteed to be a permutation
-    // of 0..40 as at=0..40.
-    // This skips the x=40 case to make a permutation of 0..39
-    //
-    int x=(a*at+b) % 41;
-    if (x == 40) {
-      skip = 1;
-    } else {
-      p[at-skip]=x;
-    }
-    x = (x+a) % 41;
-  }
+  sampleKey(p,a,b);
 }
 
 void sampleBadPermutation(Permutation p, int a,int b) {
@@ -484,13 +453,36 @@ FACTS(InitBy) {
   }
 }
 
-void sampleDeck(Deck *deck, int a, int b) {
-  Permutation permutation;
-  samplePermutation(permutation,a,b);
-  deckSet(deck,permutation);
+FACTS(InitFromArray) {
+  for (int a=1; a <= CARDS; ++a) {
+    for (int b=0; b <= CARDS; ++b) {
+      Deck deck,expect;
+      Permutation permutation;
+      samplePermutation(permutation,a,b);
+      FACT(SpiderCipherDeckInitFromArray(&deck,permutation),==,1);
+      deckSet(&expect,permutation);
+      FACT(deckCmp(&deck,&expect),==,0);
+      sampleBadPermutation(permutation,a,b);
+      FACT(SpiderCipherDeckInitFromArray(&deck,permutation),==,0);
+      FACT(SpiderCipherDeckInitBy(&deck,PermutationFunction,&permutation),==,0);
+    }
+  }
+
+  // out of range cards that alias low bits of the mask
+  Card bad[] = { CARDS, 63, 64, 64+5, 128, 255 };
+  for (int i=0; i<(int)(sizeof(bad)/sizeof(bad[0])); ++i) {
+    for (int at=0; at<CARDS; at += 13) {
+      Deck deck;
+      Permutation permutation;
+      samplePermutation(permutation,7,3);
+      permutation[at]=bad[i];
+      FACT(SpiderCipherDeckInitFromArray(&deck,permutation),==,0);
+    }
+  }
 }
 
 
+
 Card testCutCard(Deck *deck, Card clear) {
   Card card = (deck->cards[CUT_ZTH] + clear) % CARDS;
   assert(card == SpiderCipherCutCard(deck,clear));
@@ -682,6 +674,9 @@ void CutShuffleCutTestDeck(struct FactsStruct *facts, Deck *original) {
     deckMix(&expect,BACK_FRONT);
     deckMix(&expect,*CUTS[cutAtAfter]);
     FACT(deckCmp(&deck,&expect),==,0);
+    SpiderCipherCutShuffleCutDeck(original,original->cards[cutAtBefore],
+                                  expect.cards[0],&spare,SpiderCipherOps());
+    FACT(deckCmp(&spare,&expect),==,0);
     InverseCutShuffleCut(&deck,cutAtBefore,cutAtAfter);
     FACT(deckCmp(&deck,original),==,0);
         }
@@ -718,6 +713,87 @@ void InversePseudoShuffleCutAt(Deck *deck, uint8_t cutAt) {
   InverseCutShuffleCut(deck,cutAt,0);
 }
 
+void AdvanceDeckUnfused(Deck *deck, Card clear) {
+  Deck spare;
+  Card tagCard = (deck->cards[TAG_ZTH]+TAG_ADD) % CARDS;
+  Card cutCard = testCutCard(deck,clear);
+  SpiderCipherCutDeck(deck,tagCard,&spare);
+  SpiderCipherBackFrontShuffleDeck(&spare,deck);
+  SpiderCipherCutDeck(deck,cutCard,&spare);
+  SpiderCipherCopyDeck(&spare,deck);
+}
+
+FACTS(AdvanceDeck) {
+  for (int a=1; a <= CARDS; ++a) {
+    for (int b=0; b <= CARDS; ++b) {
+      for (Card clear = 0; clear < CARDS; ++clear) {
+	Deck deck,expect,spare;
+	sampleDeck(&deck,a,b);
+	sampleDeck(&expect,a,b);
+	SpiderCipherAdvanceDeck(&deck,clear,&spare);
+	AdvanceDeckUnfused(&expect,clear);
+	FACT(deckCmp(&deck,&expect),==,0);
+      }
+    }
+  }
+}
+
+void testEngine(struct FactsStruct *facts, const SpiderCipherEngineOps *ops,
+                Deck *deck) {
+  Deck expect,out;
+  for (uint8_t cutAt=0; cutAt<CARDS; ++cutAt) {
+    SpiderCipherCutDeckScalar(deck,cutAt,&expect);
+    ops->cutDeck(deck,cutAt,&out);
+    FACT(deckCmp(&out,&expect),==,0);
+  }
+  SpiderCipherBackFrontShuffleDeckScalar(deck,&expect);
+  ops->backFrontShuffleDeck(deck,&out);
+  FACT(deckCmp(&out,&expect),==,0);
+  for (uint8_t tagAt=0; tagAt<CARDS; ++tagAt) {
+    for (uint8_t cutAt=0; cutAt<CARDS; ++cutAt) {
+      SpiderCipherCutShuffleCutDeckScalar(deck,tagAt,cutAt,&expect);
+      ops->cutShuffleCutDeck(deck,tagAt,cutAt,&out);
+      FACT(deckCmp(&out,&expect),==,0);
+      Card cards[CARDS];
+      ops->cutShuffleCutCards(deck->cards,tagAt,cutAt,cards);
+      FACT(cardsCmp(CARDS,cards,expect.cards),==,0);
+    }
+  }
+  for (Card card=0; card<CARDS; ++card) {
+    FACT(ops->findCard(deck->cards,card),==,deck->ats[card]);
+  }
+}
+
+FACTS(Engines) {
+  int engines[] = { SPIDER_CIPHER_ENGINE_SCALAR,
+		    SPIDER_CIPHER_ENGINE_SSE41,
+		    SPIDER_CIPHER_ENGINE_AVX2,
+		    SPIDER_CIPHER_ENGINE_TABLE };
+  int was = SpiderCipherEngine();
+  FACT(SpiderCipherEngineSelect(SPIDER_CIPHER_ENGINE_AUTO),==,1);
+  FACT(SpiderCipherEngine(),!=,SPIDER_CIPHER_ENGINE_AUTO);
+  FACT(SpiderCipherEngine(),!=,SPIDER_CIPHER_ENGINE_TABLE);
+  FACT(SpiderCipherEngineSelect(-1),==,0);
+  for (int e=0; e<4; ++e) {
+    const SpiderCipherEngineOps *ops = SpiderCipherEngineOpsFor(engines[e]);
+    if (ops == NULL) {
+      fprintf(stderr,"engine %d not available.\n",engines[e]);
+      continue;
+    }
+    FACT(SpiderCipherEngineSelect(engines[e]),==,1);
+    FACT(SpiderCipherEngine(),==,engines[e]);
+    for (int a=1; a <= CARDS; ++a) {
+      for (int b=0; b <= CARDS; ++b) {
+	if ((a*1299827+9973*b) % 11 != 0) continue;
+	Deck deck;
+	sampleDeck(&deck,a,b);
+	testEngine(facts,ops,&deck);
+      }
+    }
+  }
+  SpiderCipherEngineSelect(was);
+}
+
 FACTS(CutCardUniform) {
   for (int a=1; a <= CARDS; ++a) {
     for (int b=0; b <= CARDS; ++b) {    
@@ -752,6 +828,152 @@ FACTS(NoiseCardUniform) {
   }
 }
 
+#define PACKET 97
+
+void samplePacket(Card *packet, int a, int b) {
+  for (int i=0; i<PACKET; ++i) {
+    packet[i]=(a*i+b) % CARDS;
+  }
+}
+
+void scrambleLoop(Deck *deck, const Card *in, Card *out, int n) {
+  Deck spare;
+  for (int i=0; i<n; ++i) {
+    Card clear = in[i];
+    out[i] = SpiderCipherScramble(deck,clear);
+    SpiderCipherAdvanceDeck(deck,clear,&spare);
+  }
+}
+
+FACTS(ScrambleBuffer) {
+  for (int a=1; a <= CARDS; ++a) {
+    for (int b=0; b <= CARDS; ++b) {
+      Deck expectDeck,deck,inPlaceDeck;
+      Card clear[PACKET],expect[PACKET],scrambled[PACKET],inPlace[PACKET];
+      samplePacket(clear,a,b);
+      sampleDeck(&expectDeck,a,b);
+      sampleDeck(&deck,a,b);
+      sampleDeck(&inPlaceDeck,a,b);
+      scrambleLoop(&expectDeck,clear,expect,PACKET);
+      SpiderCipherScrambleBuffer(&deck,clear,scrambled,PACKET);
+      memcpy(inPlace,clear,PACKET);
+      SpiderCipherScrambleBuffer(&inPlaceDeck,inPlace,inPlace,PACKET);
+      FACT(cardsCmp(PACKET,scrambled,expect),==,0);
+      FACT(cardsCmp(PACKET,inPlace,expect),==,0);
+      FACT(deckCmp(&deck,&expectDeck),==,0);
+      FACT(deckCmp(&inPlaceDeck,&expectDeck),==,0);
+    }
+  }
+}
+
+FACTS(UnscrambleBuffer) {
+  for (int a=1; a <= CARDS; ++a) {
+    for (int b=0; b <= CARDS; ++b) {
+      Deck scrambleDeck,deck,inPlaceDeck;
+      Card clear[PACKET],scrambled[PACKET],unscrambled[PACKET],inPlace[PACKET];
+      samplePacket(clear,a,b);
+      sampleDeck(&scrambleDeck,a,b);
+      sampleDeck(&deck,a,b);
+      sampleDeck(&inPlaceDeck,a,b);
+      SpiderCipherScrambleBuffer(&scrambleDeck,clear,scrambled,PACKET);
+      SpiderCipherUnscrambleBuffer(&deck,scrambled,unscrambled,PACKET);
+      memcpy(inPlace,scrambled,PACKET);
+      SpiderCipherUnscrambleBuffer(&inPlaceDeck,inPlace,inPlace,PACKET);
+      FACT(cardsCmp(PACKET,unscrambled,clear),==,0);
+      FACT(cardsCmp(PACKET,inPlace,clear),==,0);
+      FACT(deckCmp(&deck,&scrambleDeck),==,0);
+      FACT(deckCmp(&inPlaceDeck,&scrambleDeck),==,0);
+    }
+  }
+}
+
+FACTS(LazyDeck) {
+  for (int a=1; a <= CARDS; ++a) {
+    for (int b=0; b <= CARDS; ++b) {
+      Deck deck,spare,fromLazy;
+      SpiderCipherLazyDeck lazy,lazySpare;
+      sampleDeck(&deck,a,b);
+      SpiderCipherLazyDeckFrom(&lazy,&deck);
+      for (int i=0; i<PACKET; ++i) {
+	Card clear = (a*i+b) % CARDS;
+	Card scrambled = SpiderCipherScramble(&deck,clear);
+	FACT(SpiderCipherLazyScramble(&lazy,clear),==,scrambled);
+	FACT(SpiderCipherLazyUnscramble(&lazy,scrambled),==,clear);
+	SpiderCipherAdvanceDeck(&deck,clear,&spare);
+	SpiderCipherLazyAdvanceDeck(&lazy,clear,&lazySpare);
+	SpiderCipherDeckFromLazy(&fromLazy,&lazy);
+	FACT(deckCmp(&fromLazy,&deck),==,0);
+      }
+    }
+  }
+}
+
+FACTS(LazyBuffer) {
+  for (int a=1; a <= CARDS; ++a) {
+    for (int b=0; b <= CARDS; ++b) {
+      Deck deck,fromLazy;
+      SpiderCipherLazyDeck lazy,unlazy;
+      Card clear[PACKET],expect[PACKET],scrambled[PACKET],unscrambled[PACKET];
+      samplePacket(clear,a,b);
+      sampleDeck(&deck,a,b);
+      SpiderCipherLazyDeckFrom(&lazy,&deck);
+      SpiderCipherLazyDeckFrom(&unlazy,&deck);
+      SpiderCipherScrambleBuffer(&deck,clear,expect,PACKET);
+      SpiderCipherLazyScrambleBuffer(&lazy,clear,scrambled,PACKET);
+      FACT(cardsCmp(PACKET,scrambled,expect),==,0);
+      SpiderCipherDeckFromLazy(&fromLazy,&lazy);
+      FACT(deckCmp(&fromLazy,&deck),==,0);
+      SpiderCipherLazyUnscrambleBuffer(&unlazy,scrambled,unscrambled,PACKET);
+      FACT(cardsCmp(PACKET,unscrambled,clear),==,0);
+      FACT(cardsCmp(CARDS,unlazy.cards,lazy.cards),==,0);
+    }
+  }
+}
+
+FACTS(RotatedDeck) {
+  for (int a=1; a <= CARDS; ++a) {
+    for (int b=0; b <= CARDS; ++b) {
+      Deck deck,spare,fromRotated;
+      SpiderCipherRotatedDeck rotated,rotatedSpare;
+      sampleDeck(&deck,a,b);
+      SpiderCipherRotatedDeckFrom(&rotated,&deck);
+      for (int i=0; i<PACKET; ++i) {
+	Card clear = (a*i+b) % CARDS;
+	Card scrambled = SpiderCipherScramble(&deck,clear);
+	FACT(SpiderCipherRotatedScramble(&rotated,clear),==,scrambled);
+	FACT(SpiderCipherRotatedUnscramble(&rotated,scrambled),==,clear);
+	SpiderCipherAdvanceDeck(&deck,clear,&spare);
+	SpiderCipherRotatedAdvanceDeck(&rotated,clear,&rotatedSpare);
+	SpiderCipherDeckFromRotated(&fromRotated,&rotated);
+	FACT(deckCmp(&fromRotated,&deck),==,0);
+      }
+    }
+  }
+}
+
+FACTS(RotatedBuffer) {
+  for (int a=1; a <= CARDS; ++a) {
+    for (int b=0; b <= CARDS; ++b) {
+      Deck deck,fromRotated,fromUnrotated;
+      SpiderCipherRotatedDeck rotated,unrotated;
+      Card clear[PACKET],expect[PACKET],scrambled[PACKET],unscrambled[PACKET];
+      samplePacket(clear,a,b);
+      sampleDeck(&deck,a,b);
+      SpiderCipherRotatedDeckFrom(&rotated,&deck);
+      SpiderCipherRotatedDeckFrom(&unrotated,&deck);
+      SpiderCipherScrambleBuffer(&deck,clear,expect,PACKET);
+      SpiderCipherRotatedScrambleBuffer(&rotated,clear,scrambled,PACKET);
+      FACT(cardsCmp(PACKET,scrambled,expect),==,0);
+      SpiderCipherDeckFromRotated(&fromRotated,&rotated);
+      FACT(deckCmp(&fromRotated,&deck),==,0);
+      SpiderCipherRotatedUnscrambleBuffer(&unrotated,scrambled,unscrambled,PACKET);
+      FACT(cardsCmp(PACKET,unscrambled,clear),==,0);
+      SpiderCipherDeckFromRotated(&fromUnrotated,&unrotated);
+      FACT(deckCmp(&fromUnrotated,&deck),==,0);
+    }
+  }
+}
+
 int KnownPlainConsistent(Deck *deck, Card clear, Card scramble) {
    return SpiderCipherScramble(deck,clear) == scramble;
 }
@@ -759,36 +981,28 @@ int KnownPlainConsistent(Deck *deck, Card clear, Card scramble) {
 #include <stdio.h>
 
 int randrange(int a, int b) {
-   static FILE *dev = 0;
-   if (dev == 0) dev = fopen("/dev/random","rb");
    if (b <= a) return a;
-   unsigned n = (b-a+1);
-   unsigned x;
-   // perfect binning
-   do {
-     assert(fread(&x,sizeof(x),1,dev)==1);
-   } while (x <= ((~0U) % n));
-   return a + (x%n);
+   return a + FactsRandomRange(b-a+1);
 }
 
 FACTS(RandRange) {
   const int a = 3;
   const int b = 9;
   int n = 10000;
-  int counts[b+1];
+  int counts[b+2];
   double p = 1.0/(b-a+1);
   double q = 1.0-p;
   double mu = n*p;
   double sigma = sqrt(n*p*q);
-  for (int i=0; i<=b; ++i) {
+  for (int i=0; i<=b+1; ++i) {
      counts[i]=0;
   }
   for (int i=0; i<n; ++i) {
      ++counts[(randrange(3,9))];
   }
 
-   for (int i=0; i<=10; ++i) {
-     if (i < 3 || i > 9) {
+   for (int i=0; i<=b+1; ++i) {
+     if (i < a || i > b) {
        FACT(counts[i],==,0);
      } else {
        double z =(counts[i]-mu)/sigma;
@@ -0,0 +1,20 @@
+#pragma once
+
+//
+// The cut and the back-front shuffle as separate steps, through the
+// selected engine: the reference the fused advance is checked
+// against.  The core itself only runs them fused, so they live with
+// the facts that #include "../src/spider_cipher_core.c" (first).
+//
+
+static void SpiderCipherCutDeck(SpiderCipherDeck *input,
+				SpiderCipherCard cut,
+				SpiderCipherDeck *output) {
+  if (cut >= SPIDER_CIPHER_CARDS) return;
+  SpiderCipherOps()->cutDeck(input,input->ats[cut],output);
+}
+
+static void SpiderCipherBackFrontShuffleDeck(SpiderCipherDeck *input,
+					     SpiderCipherDeck *output) {
+  SpiderCipherOps()->backFrontShuffleDeck(input,output);
+}
@@ -0,0 +1,208 @@
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include "facts.h"
+#include "spider_cipher.hpp"
+#include "spider_cipher_samples.h"
+#include "../src/spider_cipher_internal.h"
+
+#define CARDS SPIDER_CIPHER_CARDS
+#define PACKET 61
+
+typedef SpiderCipherDeck CDeck;
+typedef SpiderCipherCard Card;
+
+// the shared sample key as an array.
+constexpr std::array<Card,CARDS> sampleKey(int a, int b) {
+  std::array<Card,CARDS> key{};
+  sampleKey(key.data(),a,b);
+  return key;
+}
+
+constexpr std::array<Card,PACKET> samplePacket(int seed) {
+  std::array<Card,PACKET> packet{};
+  for (int i=0; i<PACKET; ++i) {
+    packet[i]=Card((i*i+seed*i+seed) % CARDS);
+  }
+  return packet;
+}
+
+bool wiped(const CDeck &deck) {
+  CDeck zero;
+  SpiderCipherDeckInit(&zero);
+  return deckCmp(&deck,&zero) == 0;
+}
+
+// a whole packet worked out by the compiler.
+constexpr std::array<Card,PACKET> compileTimeScramble(int a, int b, int seed) {
+  spider::Deck deck;
+  std::array<Card,CARDS> key = sampleKey(a,b);
+  std::array<Card,PACKET> packet = samplePacket(seed);
+  deck.init(key);
+  deck.steps<spider::Mode::Scramble>(packet,packet);
+  return packet;
+}
+
+constexpr bool compileTimeRoundTrip(int a, int b, int seed) {
+  std::array<Card,CARDS> key = sampleKey(a,b);
+  std::array<Card,PACKET> packet = samplePacket(seed);
+  std::array<Card,PACKET> scrambled = compileTimeScramble(a,b,seed);
+  spider::Deck deck;
+  deck.init(key);
+  deck.steps<spider::Mode::Unscramble>(scrambled,scrambled);
+  for (int i=0; i<PACKET; ++i) {
+    if (scrambled[i] != packet[i]) return false;
+  }
+  return true;
+}
+
+static_assert(spider::Deck().card(17) == 17, "identity deck");
+static_assert(spider::Deck::TAG_ZTH == SPIDER_CIPHER_TAG_ZTH, "tag zth as the core");
+static_assert(spider::Deck::TAG_ADD == SPIDER_CIPHER_TAG_ADD, "tag add as the core");
+static_assert(spider::Deck::CUT_ZTH == SPIDER_CIPHER_CUT_ZTH, "cut zth as the core");
+static_assert(spider::Deck().cut(5).card(0) == 5, "cut brings card to top");
+static_assert(spider::Deck().cut(5).at(5) == 0, "cut moves ats");
+static_assert(spider::Deck().backFrontShuffle().card(0) == 39, "odd cards to front");
+static_assert(spider::Deck().backFrontShuffle().card(20) == 0, "even cards to back");
+static_assert(compileTimeRoundTrip(7,3,1), "constexpr round trip");
+
+constexpr std::array<Card,PACKET> SCRAMBLED_7_3_1 = compileTimeScramble(7,3,1);
+
+FACTS(ConstexprMatchesCore) {
+  std::array<Card,CARDS> key = sampleKey(7,3);
+  std::array<Card,PACKET> packet = samplePacket(1);
+  std::array<Card,PACKET> out;
+  CDeck deck;
+  FACT(SpiderCipherDeckInitFromArray(&deck,key.data()),==,1);
+  SpiderCipherScrambleBuffer(&deck,packet.data(),out.data(),PACKET);
+  FACT(memcmp(out.data(),SCRAMBLED_7_3_1.data(),PACKET),==,0);
+}
+
+FACTS(DeckInit) {
+  spider::Deck deck;
+  CDeck expect;
+  SpiderCipherDeckInit(&expect);
+  FACT(deckCmp(&deck.c(),&expect),==,0);
+
+  for (int a=1; a<=CARDS; ++a) {
+    for (int b=0; b<=CARDS; ++b) {
+      std::array<Card,CARDS> key = sampleKey(a,b);
+      FACT(deck.init(key),==,true);
+      SpiderCipherDeckInitFromArray(&expect,key.data());
+      FACT(deckCmp(&deck.c(),&expect),==,0);
+    }
+  }
+
+  std::array<Card,CARDS> key = sampleKey(7,3);
+  key[5]=key[6];
+  FACT(deck.init(key),==,false);
+  FACT(wiped(deck.c()),==,true);
+  FACT(deck.init(spider::span<const Card>(key.data(),CARDS-1)),==,false);
+}
+
+// every sample key and every clear card: one step is the C
+// scramble (or unscramble) and advance.
+FACTS(StepMatchesCore) {
+  int wrong = 0;
+  for (int a=1; a<=CARDS; ++a) {
+    for (int b=0; b<=CARDS; ++b) {
+      std::array<Card,CARDS> key = sampleKey(a,b);
+      for (Card clear=0; clear<CARDS; ++clear) {
+	spider::Deck deck;
+	CDeck cDeck,spare;
+	deck.init(key);
+	SpiderCipherDeckInitFromArray(&cDeck,key.data());
+	SpiderCipherDeckInit(&spare);
+
+	spider::Deck unDeck = deck;
+	Card scrambled = deck.step<spider::Mode::Scramble>(clear);
+	if (scrambled != SpiderCipherScramble(&cDeck,clear)) ++wrong;
+	if (unDeck.step<spider::Mode::Unscramble>(scrambled) != clear) ++wrong;
+	SpiderCipherAdvanceDeck(&cDeck,clear,&spare);
+	if (deckCmp(&deck.c(),&cDeck) != 0) ++wrong;
+	if (deck != unDeck) ++wrong;
+      }
+    }
+  }
+  FACT(wrong,==,0);
+}
+
+// sessions give the C buffer output on every engine, across
+// packets, in place or not.
+FACTS(SessionMatchesCore) {
+  int engines[] = { SPIDER_CIPHER_ENGINE_SCALAR, SPIDER_CIPHER_ENGINE_SSE41,
+		    SPIDER_CIPHER_ENGINE_AVX2, SPIDER_CIPHER_ENGINE_TABLE };
+  int engine = SpiderCipherEngine();
+  int wrong = 0;
+  for (int e : engines) {
+    if (!SpiderCipherEngineSelect(e)) continue;
+    for (int a=1; a<=CARDS; a += 3) {
+      for (int b=0; b<=CARDS; b += 5) {
+	std::array<Card,CARDS> key = sampleKey(a,b);
+	spider::Scrambler scrambler(key);
+	spider::Unscrambler unscrambler(key);
+	CDeck deck;
+	SpiderCipherDeckInitFromArray(&deck,key.data());
+	if (!scrambler || !unscrambler) ++wrong;
+	for (int seed=0; seed<3; ++seed) {
+	  std::array<Card,PACKET> packet = samplePacket(seed+a);
+	  std::array<Card,PACKET> expect;
+	  std::vector<Card> out(PACKET);
+	  SpiderCipherScrambleBuffer(&deck,packet.data(),expect.data(),PACKET);
+	  if (scrambler(packet,out) != PACKET) ++wrong;
+	  if (memcmp(out.data(),expect.data(),PACKET) != 0) ++wrong;
+	  if (unscrambler(out) != PACKET) ++wrong;
+	  if (memcmp(out.data(),packet.data(),PACKET) != 0) ++wrong;
+	}
+	if (deckCmp(&scrambler.deck().c(),&deck) != 0) ++wrong;
+	if (scrambler.deck() != unscrambler.deck()) ++wrong;
+      }
+    }
+  }
+  SpiderCipherEngineSelect(engine);
+  FACT(wrong,==,0);
+}
+
+FACTS(SessionBadKey) {
+  std::array<Card,CARDS> key = sampleKey(7,3);
+  std::array<Card,PACKET> packet = samplePacket(1);
+  std::array<Card,PACKET> out{};
+  key[0]=CARDS;
+  spider::Scrambler scrambler(key);
+  FACT(scrambler.ok(),==,false);
+  FACT(scrambler(packet,out),==,0u);
+  FACT(wiped(scrambler.deck().c()),==,true);
+
+  key = sampleKey(7,3);
+  spider::Scrambler good(key);
+  FACT(good(packet,spider::span<Card>(out.data(),PACKET-1)),==,0u);
+}
+
+FACTS(SessionMove) {
+  std::array<Card,CARDS> key = sampleKey(11,5);
+  std::array<Card,PACKET> packet = samplePacket(2);
+  std::array<Card,PACKET> expect,out;
+  spider::Scrambler scrambler(key);
+  spider::Scrambler reference(key);
+  reference(packet,expect);
+
+  spider::Scrambler moved(std::move(scrambler));
+  FACT(scrambler.ok(),==,false);
+  FACT(wiped(scrambler.deck().c()),==,true);
+  FACT(moved(packet,out),==,(size_t) PACKET);
+  FACT(memcmp(out.data(),expect.data(),PACKET),==,0);
+
+  spider::Scrambler other(sampleKey(3,1));
+  other = std::move(moved);
+  FACT(moved.ok(),==,false);
+  FACT(wiped(moved.deck().c()),==,true);
+  reference(packet,expect);
+  other(packet,out);
+  FACT(memcmp(out.data(),expect.data(),PACKET),==,0);
+
+  FACT(std::is_copy_constructible_v<spider::Scrambler>,==,false);
+  FACT(std::is_copy_assignable_v<spider::Scrambler>,==,false);
+}
+
+FACTS_FAST
@@ -0,0 +1,159 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "facts.h"
+#include "spider_cipher_packed.h"
+#include "spider_cipher_samples.h"
+
+#define CARDS SPIDER_CIPHER_CARDS
+#define MAX 2100
+
+typedef SpiderCipherDeck Deck;
+typedef SpiderCipherCard Card;
+
+int engines[] = { SPIDER_CIPHER_ENGINE_SCALAR, SPIDER_CIPHER_ENGINE_SSE41,
+		  SPIDER_CIPHER_ENGINE_AVX2, SPIDER_CIPHER_ENGINE_TABLE };
+#define ENGINES (sizeof(engines)/sizeof(engines[0]))
+
+// the format one bit at a time.
+void packBits(const Card *cards, uint8_t *packed, size_t n) {
+  memset(packed,0,SPIDER_CIPHER_PACKED_BYTES(n));
+  for (size_t bit=0; bit<6*n; ++bit) {
+    int value = (cards[bit/6] >> (5-bit%6)) & 1;
+    packed[bit/8] |= value << (7-bit%8);
+  }
+}
+
+Card cards[MAX];
+Card back[MAX+64];
+uint8_t expect[MAX];
+uint8_t packed[MAX+64];
+
+FACTS(PackedKnown) {
+  Card deck[4] = { 0, 1, 2, 3 };
+  uint8_t bytes[3];
+  FACT(SpiderCipherPack(deck,bytes,4),==,3);
+  FACT(bytes[0],==,0x00);
+  FACT(bytes[1],==,0x10);
+  FACT(bytes[2],==,0x83);
+  FACT(SPIDER_CIPHER_PACKED_BYTES(CARDS),==,30);
+  FACT(SPIDER_CIPHER_PACKED_BYTES(1),==,1);
+  FACT(SPIDER_CIPHER_PACKED_BYTES(5),==,4);
+}
+
+// every length up to MAX on every engine packs as the bit at a
+// time reference, touches no byte past the end, and unpacks back.
+FACTS(PackedRoundTrip) {
+  int engine = SpiderCipherEngine();
+  int wrong = 0;
+  for (size_t e=0; e<ENGINES; ++e) {
+    if (!SpiderCipherEngineSelect(engines[e])) continue;
+    for (size_t n=0; n<=MAX; n += (n < 200 ? 1 : 97)) {
+      for (size_t i=0; i<n; ++i) cards[i]=FactsRandomRange(CARDS);
+      packBits(cards,expect,n);
+      size_t bytes = SPIDER_CIPHER_PACKED_BYTES(n);
+      memset(packed,0xa5,sizeof(packed));
+      if (SpiderCipherPack(cards,packed,n) != bytes) ++wrong;
+      if (memcmp(packed,expect,bytes) != 0) ++wrong;
+      if (packed[bytes] != 0xa5) ++wrong;
+      memset(back,0xa5,sizeof(back));
+      if (SpiderCipherUnpack(packed,back,n) != 1) ++wrong;
+      if (memcmp(back,cards,n) != 0) ++wrong;
+      if (back[n] != 0xa5) ++wrong;
+    }
+  }
+  SpiderCipherEngineSelect(engine);
+  FACT(wrong,==,0);
+}
+
+// a card of 40..63 anywhere (SIMD part or tail) is reported.
+FACTS(PackedBadCard) {
+  int engine = SpiderCipherEngine();
+  int missed = 0;
+  size_t n = 301;
+  for (size_t e=0; e<ENGINES; ++e) {
+    if (!SpiderCipherEngineSelect(engines[e])) continue;
+    for (size_t at=0; at<n; ++at) {
+      for (size_t i=0; i<n; ++i) cards[i]=i % CARDS;
+      cards[at]=CARDS+at % 24;
+      SpiderCipherPack(cards,packed,n);
+      if (SpiderCipherUnpack(packed,back,n) != 0) ++missed;
+      if (back[at] != cards[at]) ++missed;
+    }
+  }
+  SpiderCipherEngineSelect(engine);
+  FACT(missed,==,0);
+}
+
+// packed scramble and unscramble (in place and not, across chunks)
+// are pack(buffer(unpack)) on every engine.
+FACTS(ScramblePacked) {
+  int engine = SpiderCipherEngine();
+  size_t lengths[] = { 0, 1, 3, 40, 511, 512, 513, 1027, MAX };
+  int wrong = 0;
+  for (size_t e=0; e<ENGINES; ++e) {
+    if (!SpiderCipherEngineSelect(engines[e])) continue;
+    for (size_t l=0; l<sizeof(lengths)/sizeof(lengths[0]); ++l) {
+      size_t n = lengths[l];
+      Deck deck,packedDeck;
+      for (size_t i=0; i<n; ++i) cards[i]=FactsRandomRange(CARDS);
+      sampleDeck(&deck,7,3+l);
+      sampleDeck(&packedDeck,7,3+l);
+      SpiderCipherPack(cards,packed,n);
+      SpiderCipherScrambleBuffer(&deck,cards,back,n);
+      packBits(back,expect,n);
+
+      uint8_t *out = (uint8_t*) malloc(SPIDER_CIPHER_PACKED_BYTES(n)+1);
+      if (!SpiderCipherScramblePacked(&packedDeck,packed,out,n)) ++wrong;
+      if (memcmp(out,expect,SPIDER_CIPHER_PACKED_BYTES(n)) != 0) ++wrong;
+      if (memcmp(&deck,&packedDeck,sizeof(Deck)) != 0) ++wrong;
+
+      sampleDeck(&packedDeck,7,3+l);
+      if (!SpiderCipherUnscramblePacked(&packedDeck,out,out,n)) ++wrong;
+      if (memcmp(out,packed,SPIDER_CIPHER_PACKED_BYTES(n)) != 0) ++wrong;
+      free(out);
+    }
+  }
+  SpiderCipherEngineSelect(engine);
+  FACT(wrong,==,0);
+}
+
+// a card of 40..63 stops packed scramble and unscramble before its
+// chunk: the chunks before are done, the rest untouched.
+FACTS(ScramblePackedBadCard) {
+  int engine = SpiderCipherEngine();
+  size_t n = 1027, done = 512;
+  int wrong = 0;
+  for (size_t e=0; e<ENGINES; ++e) {
+    if (!SpiderCipherEngineSelect(engines[e])) continue;
+    for (int unscramble=0; unscramble<=1; ++unscramble) {
+      Deck deck,packedDeck;
+      uint8_t out[SPIDER_CIPHER_PACKED_BYTES(1027)];
+      for (size_t i=0; i<n; ++i) cards[i]=FactsRandomRange(CARDS);
+      cards[done+77]=CARDS+e;
+      sampleDeck(&deck,11,e);
+      sampleDeck(&packedDeck,11,e);
+      SpiderCipherPack(cards,packed,n);
+      if (unscramble) {
+	SpiderCipherUnscrambleBuffer(&deck,cards,back,done);
+      } else {
+	SpiderCipherScrambleBuffer(&deck,cards,back,done);
+      }
+      packBits(back,expect,done);
+
+      memset(out,0xff,sizeof(out));
+      int ok = unscramble ?
+	SpiderCipherUnscramblePacked(&packedDeck,packed,out,n) :
+	SpiderCipherScramblePacked(&packedDeck,packed,out,n);
+      if (ok != 0) ++wrong;
+      if (memcmp(out,expect,SPIDER_CIPHER_PACKED_BYTES(done)) != 0) ++wrong;
+      if (out[SPIDER_CIPHER_PACKED_BYTES(done)] != 0xff) ++wrong;
+      if (memcmp(&deck,&packedDeck,sizeof(Deck)) != 0) ++wrong;
+    }
+  }
+  SpiderCipherEngineSelect(engine);
+  FACT(wrong,==,0);
+}
+
+FACTS_FAST
@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "facts.h"
+#include "spider_cipher_pipeline.h"
+#include "spider_cipher_samples.h"
+
+#define CARDS SPIDER_CIPHER_CARDS
+#define JOBS 200
+#define PACKET 101
+
+typedef SpiderCipherDeck Deck;
+typedef SpiderCipherCard Card;
+typedef SpiderCipherPipelineJob Job;
+
+typedef struct {
+  Card cards[CARDS];
+} Key;
+
+Card key(uint8_t at, void *misc) {
+  return ((Key*) misc)->cards[at];
+}
+
+Card badKey(uint8_t at, void *misc) {
+  (void) at;
+  (void) misc;
+  return 0;
+}
+
+Key keys[JOBS];
+Card clear[JOBS][PACKET];
+Card scrambled[JOBS][PACKET];
+Card expect[JOBS][PACKET];
+Card unscrambled[JOBS][PACKET];
+Job jobs[JOBS];
+
+void setup() {
+  for (int j=0; j<JOBS; ++j) {
+    sampleKey(keys[j].cards,1+j%CARDS,(j/CARDS) % (CARDS+1));
+    for (int i=0; i<PACKET; ++i) {
+      clear[j][i] = (i*i+j) % CARDS;
+    }
+    Deck deck;
+    SpiderCipherDeckInitBy(&deck,key,&keys[j]);
+    SpiderCipherScrambleBuffer(&deck,clear[j],expect[j],PACKET);
+  }
+}
+
+// submit count jobs in pieces of at most per, collect them all.
+int runJobs(SpiderCipherPipeline *pipeline, size_t count, size_t per) {
+  int seen[JOBS];
+  size_t submitted = 0, collected = 0;
+  memset(seen,0,sizeof(seen));
+  while (collected < count) {
+    if (submitted < count) {
+      size_t k = count-submitted < per ? count-submitted : per;
+      if (!SpiderCipherPipelineSubmit(pipeline,jobs+submitted,k)) return 0;
+      submitted += k;
+    }
+    Job *done[7];
+    size_t k = SpiderCipherPipelineComplete(pipeline,done,7);
+    if (k == 0 && submitted == count) return 0;
+    for (size_t i=0; i<k; ++i) {
+      if (done[i] < jobs || done[i] >= jobs+count) return 0;
+      if (seen[done[i]-jobs]++) return 0;
+    }
+    collected += k;
+  }
+  return SpiderCipherPipelineComplete(pipeline,NULL,0) == 0;
+}
+
+FACTS(Pipeline) {
+  int threads[] = { 1, 2, 3, 8, 0 };
+  size_t pers[] = { 1, 13, JOBS };
+  setup();
+  for (int t=0; t<5; ++t) {
+    SpiderCipherPipeline *pipeline = SpiderCipherPipelineNew(threads[t]);
+    FACT(pipeline != NULL,==,1);
+    if (threads[t] > 0) {
+      FACT(SpiderCipherPipelineThreads(pipeline),==,threads[t]);
+    } else {
+      FACT(SpiderCipherPipelineThreads(pipeline),>,0);
+    }
+    for (int p=0; p<3; ++p) {
+      for (int j=0; j<JOBS; ++j) {
+	jobs[j].key = key;
+	jobs[j].misc = &keys[j];
+	jobs[j].in = clear[j];
+	jobs[j].out = scrambled[j];
+	jobs[j].n = PACKET;
+	jobs[j].unscramble = 0;
+	jobs[j].ok = 0;
+      }
+      FACT(runJobs(pipeline,JOBS,pers[p]),==,1);
+      for (int j=0; j<JOBS; ++j) {
+	FACT(jobs[j].ok,==,1);
+	FACT(memcmp(scrambled[j],expect[j],PACKET),==,0);
+	jobs[j].in = scrambled[j];
+	jobs[j].out = scrambled[j];
+	jobs[j].unscramble = 1;
+      }
+      FACT(runJobs(pipeline,JOBS,pers[p]),==,1);
+      for (int j=0; j<JOBS; ++j) {
+	FACT(memcmp(scrambled[j],clear[j],PACKET),==,0);
+      }
+    }
+    SpiderCipherPipelineFree(pipeline);
+  }
+}
+
+FACTS(PipelineBadKey) {
+  SpiderCipherPipeline *pipeline = SpiderCipherPipelineNew(2);
+  Card packet[PACKET];
+  memset(packet,7,sizeof(packet));
+  jobs[0].key = badKey;
+  jobs[0].misc = NULL;
+  jobs[0].in = packet;
+  jobs[0].out = packet;
+  jobs[0].n = PACKET;
+  jobs[0].unscramble = 0;
+  jobs[0].ok = 1;
+  FACT(runJobs(pipeline,1,1),==,1);
+  FACT(jobs[0].ok,==,0);
+  FACT(packet[0],==,7);
+  FACT(packet[PACKET-1],==,7);
+  SpiderCipherPipelineFree(pipeline);
+}
+
+FACTS(PipelineFreeWaits) {
+  SpiderCipherPipeline *pipeline = SpiderCipherPipelineNew(3);
+  setup();
+  for (int j=0; j<JOBS; ++j) {
+    jobs[j].key = key;
+    jobs[j].misc = &keys[j];
+    jobs[j].in = clear[j];
+    jobs[j].out = unscrambled[j];
+    jobs[j].n = PACKET;
+    jobs[j].unscramble = 0;
+  }
+  FACT(SpiderCipherPipelineSubmit(pipeline,jobs,JOBS),==,1);
+  SpiderCipherPipelineFree(pipeline);
+  for (int j=0; j<JOBS; ++j) {
+    FACT(memcmp(unscrambled[j],expect[j],PACKET),==,0);
+  }
+}
+
+FACTS_FAST
@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "facts.h"
+#include "spider_cipher_random.h"
+
+#define CARDS SPIDER_CIPHER_CARDS
+#define DECKS 40000
+
+typedef SpiderCipherDeck Deck;
+typedef SpiderCipherCard Card;
+
+int isDeck(Deck *deck) {
+  for (int i=0; i<CARDS; ++i) {
+    if (deck->cards[i] >= CARDS) return 0;
+    if (deck->ats[deck->cards[i]] != i) return 0;
+  }
+  return 1;
+}
+
+int64_t byteAt(void *misc) {
+  const uint8_t **at = (const uint8_t**) misc;
+  return *(*at)++;
+}
+
+int64_t bad(void *misc) {
+  (void) misc;
+  return 256;
+}
+
+Deck decks[DECKS];
+uint8_t bytes[DECKS];
+SpiderCipherEntropy entropy;
+
+// the position of every card over many decks is about uniform.
+FACTS(RandomizeDecks) {
+  static int where[CARDS][CARDS];
+  int wrong = 0;
+  memset(where,0,sizeof(where));
+  SpiderCipherEntropyInit(&entropy);
+  for (int i=0; i<DECKS; ++i) SpiderCipherDeckInit(&decks[i]);
+  FACT(SpiderCipherRandomizeDecks(decks,DECKS,&entropy),==,DECKS);
+  for (int i=0; i<DECKS; ++i) {
+    if (!isDeck(&decks[i])) ++wrong;
+    for (int at=0; at<CARDS; ++at) ++where[decks[i].cards[at]][at];
+  }
+  FACT(wrong,==,0);
+  int lo = DECKS, hi = 0;
+  for (int c=0; c<CARDS; ++c) {
+    for (int at=0; at<CARDS; ++at) {
+      if (where[c][at] < lo) lo = where[c][at];
+      if (where[c][at] > hi) hi = where[c][at];
+    }
+  }
+  // expect 1000 each, 6 sigma is about 190.
+  FACT(lo,>,DECKS/CARDS-190);
+  FACT(hi,<,DECKS/CARDS+190);
+  FACT(memcmp(&decks[0],&decks[1],sizeof(Deck)) != 0,==,1);
+  SpiderCipherEntropyFinish(&entropy);
+}
+
+// caller bytes give the same decks every time, and run out.
+FACTS(RandomizeBuffer) {
+  Deck again[4];
+  for (int i=0; i<DECKS; ++i) bytes[i] = (i*i*7+i/3) % 256;
+  SpiderCipherEntropyInitBuffer(&entropy,bytes,DECKS);
+  for (int i=0; i<4; ++i) SpiderCipherDeckInit(&decks[i]);
+  FACT(SpiderCipherRandomizeDecks(decks,4,&entropy),==,4);
+  SpiderCipherEntropyInitBuffer(&entropy,bytes,DECKS);
+  for (int i=0; i<4; ++i) SpiderCipherDeckInit(&again[i]);
+  FACT(SpiderCipherRandomizeDecks(again,4,&entropy),==,4);
+  FACT(memcmp(decks,again,sizeof(again)),==,0);
+  FACT(isDeck(&decks[3]),==,1);
+
+  // about 85 bytes a deck, so 100 bytes make one deck.
+  SpiderCipherEntropyInitBuffer(&entropy,bytes,100);
+  for (int i=0; i<4; ++i) SpiderCipherDeckInit(&decks[i]);
+  FACT(SpiderCipherRandomizeDecks(decks,4,&entropy),==,1);
+  Deck zero;
+  SpiderCipherDeckInit(&zero);
+  FACT(memcmp(&decks[1],&zero,sizeof(Deck)),==,0);
+}
+
+FACTS(RandomizeCallback) {
+  Deck deck,same;
+  const uint8_t *at = bytes;
+  for (int i=0; i<DECKS; ++i) bytes[i] = (i*i*7+i/3) % 256;
+  SpiderCipherDeckInit(&deck);
+  FACT(SpiderCipherRandomize(&deck,byteAt,&at,255),==,1);
+  FACT(isDeck(&deck),==,1);
+  at = bytes;
+  SpiderCipherDeckInit(&same);
+  SpiderCipherRandomize(&same,byteAt,&at,255);
+  FACT(memcmp(&deck,&same,sizeof(Deck)),==,0);
+
+  // randMax 1: bits, many per pick.
+  at = bytes;
+  SpiderCipherDeckInit(&deck);
+  FACT(SpiderCipherRandomize(&deck,byteAt,&at,1) == 0 || isDeck(&deck),==,1);
+
+  FACT(SpiderCipherRandomize(&deck,bad,NULL,255),==,0);
+  SpiderCipherDeckInit(&same);
+  FACT(memcmp(&deck,&same,sizeof(Deck)),==,0);
+  FACT(SpiderCipherRandomize(&deck,bad,NULL,0),==,0);
+}
+
+FACTS_FAST
@@ -0,0 +1,138 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "facts.h"
+#include "spider_cipher_rank.h"
+
+#define CARDS SPIDER_CIPHER_CARDS
+#define RANK SPIDER_CIPHER_RANK_BYTES
+#define DECKS 10000
+
+typedef SpiderCipherDeck Deck;
+typedef SpiderCipherCard Card;
+
+int isDeck(Deck *deck) {
+  for (int i=0; i<CARDS; ++i) {
+    if (deck->cards[i] >= CARDS) return 0;
+    if (deck->ats[deck->cards[i]] != i) return 0;
+  }
+  return 1;
+}
+
+void shuffle(Deck *deck) {
+  Card cards[CARDS];
+  for (int i=0; i<CARDS; ++i) cards[i]=i;
+  for (int i=0; i<CARDS-1; ++i) {
+    int j = i+FactsRandomRange(CARDS-i);
+    Card card = cards[i];
+    cards[i]=cards[j];
+    cards[j]=card;
+  }
+  SpiderCipherDeckInitFromArray(deck,cards);
+}
+
+// big endian rank += add (no overflow out of the top byte).
+void rankAdd(uint8_t rank[RANK], unsigned add) {
+  for (int i=RANK-1; i>=0 && add != 0; --i) {
+    add += rank[i];
+    rank[i] = add;
+    add >>= 8;
+  }
+}
+
+// 40! big endian.
+void factorial(uint8_t rank[RANK]) {
+  memset(rank,0,RANK);
+  rank[RANK-1]=1;
+  for (unsigned k=2; k<=CARDS; ++k) {
+    unsigned carry = 0;
+    for (int i=RANK-1; i>=0; --i) {
+      carry += rank[i]*k;
+      rank[i] = carry;
+      carry >>= 8;
+    }
+  }
+}
+
+FACTS(RankBounds) {
+  Deck deck;
+  uint8_t rank[RANK],expect[RANK];
+
+  // 0..39 is the first order, 39..0 the last.
+  SpiderCipherDeckInit(&deck);
+  SpiderCipherRank(&deck,rank);
+  memset(expect,0,RANK);
+  FACT(memcmp(rank,expect,RANK),==,0);
+
+  Card cards[CARDS];
+  for (int i=0; i<CARDS; ++i) cards[i]=CARDS-1-i;
+  SpiderCipherDeckInitFromArray(&deck,cards);
+  SpiderCipherRank(&deck,rank);
+  factorial(expect);
+  FACT(memcmp(rank,expect,RANK),<,0);
+  rankAdd(rank,1);
+  FACT(memcmp(rank,expect,RANK),==,0);
+
+  // 40! and up are not ranks.
+  FACT(SpiderCipherUnrank(&deck,expect),==,0);
+  FACT(isDeck(&deck),==,1);
+  memset(expect,0xff,RANK);
+  FACT(SpiderCipherUnrank(&deck,expect),==,0);
+}
+
+FACTS(RankUnrank) {
+  for (int d=0; d<DECKS; ++d) {
+    Deck deck,back;
+    uint8_t rank[RANK];
+    shuffle(&deck);
+    SpiderCipherRank(&deck,rank);
+    FACT(SpiderCipherUnrank(&back,rank),==,1);
+    FACT(isDeck(&back),==,1);
+    FACT(memcmp(deck.cards,back.cards,CARDS),==,0);
+  }
+}
+
+// ranks compare as the cards do.
+FACTS(RankOrder) {
+  for (int d=0; d<DECKS; ++d) {
+    Deck a,b;
+    uint8_t rankA[RANK],rankB[RANK];
+    shuffle(&a);
+    shuffle(&b);
+    // often share a long prefix.
+    int same = FactsRandomRange(CARDS);
+    Card cards[CARDS];
+    memcpy(cards,a.cards,same);
+    int at = same;
+    for (int i=0; i<CARDS; ++i) {
+      if (memchr(cards,b.cards[i],same) == NULL) cards[at++]=b.cards[i];
+    }
+    SpiderCipherDeckInitFromArray(&b,cards);
+
+    SpiderCipherRank(&a,rankA);
+    SpiderCipherRank(&b,rankB);
+    int cardsCmp = memcmp(a.cards,b.cards,CARDS);
+    int ranksCmp = memcmp(rankA,rankB,RANK);
+    FACT((cardsCmp > 0)-(cardsCmp < 0),==,(ranksCmp > 0)-(ranksCmp < 0));
+  }
+}
+
+// the next order (swap the last two, when they rise) is the next rank.
+FACTS(RankNext) {
+  for (int d=0; d<DECKS; ++d) {
+    Deck deck;
+    uint8_t rank[RANK],next[RANK];
+    shuffle(&deck);
+    if (deck.cards[CARDS-2] > deck.cards[CARDS-1]) continue;
+    SpiderCipherRank(&deck,rank);
+    Card card = deck.cards[CARDS-2];
+    deck.cards[CARDS-2]=deck.cards[CARDS-1];
+    deck.cards[CARDS-1]=card;
+    SpiderCipherRank(&deck,next);
+    rankAdd(rank,1);
+    FACT(memcmp(rank,next,RANK),==,0);
+  }
+}
+
+FACTS_FAST
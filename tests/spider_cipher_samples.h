@@ -0,0 +1,63 @@
+#pragma once
+
+#include <assert.h>
+#include <string.h>
+
+#include "spider_cipher_core.h"
+
+//
+// Sample keys and decks shared by the facts, and deck comparison.
+//
+// Sample a = 1..40 x b = 0..40 is (a*at+b) % 41 for at = 0..40
+// without the 40.  Because 41 is prime that is a permutation of
+// 0..40, so the sample is a permutation of 0..39.
+//
+// C++ facts get sampleKey as constexpr, for keys worked out by the
+// compiler.
+//
+
+#ifdef __cplusplus
+#define SAMPLES_CONSTEXPR constexpr
+#else
+#define SAMPLES_CONSTEXPR
+#endif
+
+static SAMPLES_CONSTEXPR inline void sampleKey(SpiderCipherCard *key, int a, int b) {
+  int skip=0;
+  // <= is ok here: 1 case is always skipped
+  for (int at=0; at<=SPIDER_CIPHER_CARDS; ++at) {
+    int x=(a*at+b) % 41;
+    if (x == 40) {
+      skip = 1;
+    } else {
+      key[at-skip]=(SpiderCipherCard) x;
+    }
+  }
+}
+
+static inline void sampleDeck(SpiderCipherDeck *deck, int a, int b) {
+  sampleKey(deck->cards,a,b);
+  for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+    deck->ats[deck->cards[i]]=i;
+  }
+}
+
+// cards and ats are each other's inverse.
+static inline void deckOk(const SpiderCipherDeck *deck) {
+  for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+    assert(deck->ats[i] < SPIDER_CIPHER_CARDS);
+    assert(deck->cards[i] < SPIDER_CIPHER_CARDS);
+  }
+  for (uint8_t i=0; i<SPIDER_CIPHER_CARDS; ++i) {
+    assert(deck->cards[deck->ats[i]]==i);
+    assert(deck->ats[deck->cards[i]]==i);
+  }
+  (void) deck;
+}
+
+// well formed decks in card order.
+static inline int deckCmp(const SpiderCipherDeck *a, const SpiderCipherDeck *b) {
+  deckOk(a);
+  deckOk(b);
+  return memcmp(a->cards,b->cards,SPIDER_CIPHER_CARDS);
+}
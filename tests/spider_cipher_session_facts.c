@@ -0,0 +1,201 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "facts.h"
+#include "spider_cipher_session.h"
+#include "spider_cipher_samples.h"
+
+#define CARDS SPIDER_CIPHER_CARDS
+#define MESSAGE 4099
+#define SPLITS 50
+#define INTERVAL 64
+#define CAPACITY (MESSAGE/INTERVAL+1)
+
+typedef SpiderCipherDeck Deck;
+typedef SpiderCipherCard Card;
+typedef SpiderCipherSession Session;
+
+Card keyAt(uint8_t at, void *misc) {
+  return ((Card*) misc)[at];
+}
+
+Card message[MESSAGE];
+Card expect[MESSAGE];
+Card out[MESSAGE];
+Card back[MESSAGE];
+SpiderCipherCheckpoint checkpoints[CAPACITY];
+
+void setup(Card *key, int a, int b) {
+  Deck deck;
+  sampleKey(key,a,b);
+  for (int i=0; i<MESSAGE; ++i) {
+    message[i] = FactsRandomRange(CARDS);
+  }
+  SpiderCipherDeckInitFromArray(&deck,key);
+  SpiderCipherScrambleBuffer(&deck,message,expect,MESSAGE);
+  SpiderCipherDeckInit(&deck);
+}
+
+// feed in[0..MESSAGE-1] in random chunks (empty ones too), mostly
+// short, sometimes long.
+void feedSplit(Session *session, const Card *in, Card *to) {
+  size_t at = 0;
+  while (at < MESSAGE) {
+    size_t n = FactsRandomRange(4) == 0 ? FactsRandomRange(1000) : FactsRandomRange(9);
+    if (n > MESSAGE-at) n = MESSAGE-at;
+    SpiderCipherSessionFeed(session,in+at,to+at,n);
+    at += n;
+  }
+}
+
+FACTS(SessionWhole) {
+  Card key[CARDS];
+  Session session;
+  setup(key,7,3);
+  FACT(SpiderCipherSessionInit(&session,key,0),==,1);
+  FACT(SpiderCipherSessionFeed(&session,message,out,MESSAGE),==,MESSAGE);
+  FACT(memcmp(out,expect,MESSAGE),==,0);
+  FACT(session.cards,==,MESSAGE);
+
+  FACT(SpiderCipherSessionInitBy(&session,keyAt,key,1),==,1);
+  FACT(SpiderCipherSessionFeed(&session,out,out,MESSAGE),==,MESSAGE);
+  FACT(memcmp(out,message,MESSAGE),==,0);
+  SpiderCipherSessionFinish(&session);
+}
+
+// the same message in random splits, scrambled and unscrambled
+// (in place), always gives the one-buffer cards.
+FACTS(SessionRandomSplits) {
+  Card key[CARDS];
+  Session session;
+  int wrong = 0;
+  for (int split=0; split<SPLITS; ++split) {
+    setup(key,1+split % CARDS,split % (CARDS+1));
+    SpiderCipherSessionInit(&session,key,0);
+    feedSplit(&session,message,out);
+    if (memcmp(out,expect,MESSAGE) != 0) ++wrong;
+    if (session.cards != MESSAGE) ++wrong;
+
+    memcpy(back,out,MESSAGE);
+    SpiderCipherSessionInit(&session,key,1);
+    feedSplit(&session,back,back);
+    if (memcmp(back,message,MESSAGE) != 0) ++wrong;
+  }
+  SpiderCipherSessionFinish(&session);
+  FACT(wrong,==,0);
+}
+
+FACTS(SessionBadKey) {
+  Card key[CARDS];
+  Session session;
+  setup(key,7,3);
+  key[3]=key[4];
+  FACT(SpiderCipherSessionInit(&session,key,0),==,0);
+  memset(out,0,MESSAGE);
+  FACT(SpiderCipherSessionFeed(&session,message,out,MESSAGE),==,0);
+  FACT(out[0],==,0);
+  FACT(session.cards,==,0);
+}
+
+FACTS(SessionFinish) {
+  Card key[CARDS];
+  Session session;
+  Deck zero;
+  SpiderCipherDeckInit(&zero);
+  setup(key,11,5);
+  SpiderCipherSessionInit(&session,key,0);
+  SpiderCipherSessionFeed(&session,message,out,100);
+  FACT(memcmp(&session.deck,&zero,sizeof(Deck)) != 0,==,1);
+  SpiderCipherSessionFinish(&session);
+  FACT(memcmp(&session.deck,&zero,sizeof(Deck)),==,0);
+  FACT(SpiderCipherSessionFeed(&session,message,out,100),==,0);
+}
+
+// seek anywhere in a logged message (forwards, backwards, back past
+// what was fed since) and the rest of the message is the one-buffer
+// cards.
+FACTS(SessionSeek) {
+  Card key[CARDS];
+  Session session;
+  SpiderCipherCheckpointLog log;
+  int wrong = 0;
+  for (int unscramble=0; unscramble<=1; ++unscramble) {
+    const Card *in = unscramble ? expect : message;
+    const Card *want = unscramble ? message : expect;
+    setup(key,7,3);
+    SpiderCipherCheckpointLogInit(&log,checkpoints,CAPACITY,INTERVAL);
+    FACT(SpiderCipherSessionInit(&session,key,unscramble),==,1);
+    FACT(SpiderCipherSessionLog(&session,&log),==,1);
+    feedSplit(&session,in,out);
+    FACT(memcmp(out,want,MESSAGE),==,0);
+    FACT(log.count,==,MESSAGE/INTERVAL+1);
+    FACT(log.interval,==,INTERVAL);
+
+    for (int seek=0; seek<SPLITS; ++seek) {
+      size_t offset = seek == 0 ? MESSAGE : FactsRandomRange(MESSAGE);
+      if (!SpiderCipherSeek(&session,offset,in)) ++wrong;
+      if (session.cards != offset) ++wrong;
+      memset(out,0,MESSAGE);
+      SpiderCipherSessionFeed(&session,in+offset,out+offset,MESSAGE-offset);
+      if (memcmp(out+offset,want+offset,MESSAGE-offset) != 0) ++wrong;
+    }
+
+    // seek to the start without the message.
+    FACT(SpiderCipherSeek(&session,0,NULL),==,1);
+    SpiderCipherSessionFeed(&session,in,out,MESSAGE);
+    FACT(memcmp(out,want,MESSAGE),==,0);
+  }
+  FACT(wrong,==,0);
+  FACT(SpiderCipherSeek(&session,(MESSAGE/INTERVAL+1)*INTERVAL,message),==,0);
+  SpiderCipherSessionFinish(&session);
+  FACT(SpiderCipherSeek(&session,0,message),==,0);
+  Card zero[CARDS] = { 0 };
+  FACT(memcmp(checkpoints[1].cards,zero,CARDS),==,0);
+}
+
+// seeks past the most cards ever fed are refused, even within the
+// last checkpoint's interval.
+FACTS(SessionSeekUnfed) {
+  Card key[CARDS];
+  Session session;
+  SpiderCipherCheckpointLog log;
+  setup(key,7,3);
+  SpiderCipherCheckpointLogInit(&log,checkpoints,CAPACITY,INTERVAL);
+  SpiderCipherSessionInit(&session,key,0);
+  SpiderCipherSessionLog(&session,&log);
+  SpiderCipherSessionFeed(&session,message,out,INTERVAL+1);
+  FACT(SpiderCipherSeek(&session,INTERVAL+2,message),==,0);
+  FACT(session.cards,==,INTERVAL+1);
+  FACT(SpiderCipherSeek(&session,1,message),==,1);
+  FACT(SpiderCipherSeek(&session,INTERVAL+1,message),==,1);
+  SpiderCipherSessionFeed(&session,message+INTERVAL+1,out+INTERVAL+1,1);
+  FACT(memcmp(out,expect,INTERVAL+2),==,0);
+  SpiderCipherSessionFinish(&session);
+}
+
+// a log too small for the message thins out, and seeks still work.
+FACTS(SessionSeekThin) {
+  Card key[CARDS];
+  Session session;
+  SpiderCipherCheckpointLog log;
+  int wrong = 0;
+  setup(key,11,5);
+  SpiderCipherCheckpointLogInit(&log,checkpoints,8,16);
+  SpiderCipherSessionInit(&session,key,0);
+  SpiderCipherSessionLog(&session,&log);
+  feedSplit(&session,message,out);
+  FACT(memcmp(out,expect,MESSAGE),==,0);
+  FACT(log.count,<=,8);
+  FACT(log.interval*log.count,>=,MESSAGE);
+  for (int seek=0; seek<SPLITS; ++seek) {
+    size_t offset = FactsRandomRange(MESSAGE);
+    if (!SpiderCipherSeek(&session,offset,message)) ++wrong;
+    SpiderCipherSessionFeed(&session,message+offset,out+offset,MESSAGE-offset);
+    if (memcmp(out+offset,expect+offset,MESSAGE-offset) != 0) ++wrong;
+  }
+  FACT(wrong,==,0);
+  SpiderCipherSessionFinish(&session);
+}
+
+FACTS_FAST
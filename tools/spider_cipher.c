@@ -0,0 +1,230 @@
+#define _DEFAULT_SOURCE 1
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "spider_cipher_session.h"
+
+//
+// Scramble or unscramble a card stream file (one card 0..39 per
+// byte):
+//
+//   bin/spider_cipher (--scramble|--unscramble) --key=file
+//                     [--engine=scalar|sse4.1|avx2|table] in [out]
+//
+// The key file is the 40 key cards, one per byte.  Without out (or
+// with out the same file as in) the input is transformed in place.
+//
+// Input and output are memory mapped and the session works straight
+// from one mapping to the other (no read/write copies).  The
+// mappings are advised sequential (and huge pages where the kernel
+// has them), and are processed in chunks that fit in L2: each chunk
+// is checked to be cards 0..39, then fed to the session.  A bad card
+// stops the run there (out is cut to the cards before it).  In place
+// the whole input is checked first, so a bad card leaves it as it
+// was.
+//
+
+#define CARDS SPIDER_CIPHER_CARDS
+#define CHUNK (64*1024)
+
+typedef SpiderCipherCard Card;
+
+static void usage(const char *name) {
+  fprintf(stderr,
+	  "usage: %s (--scramble|--unscramble) --key=file "
+	  "[--engine=scalar|sse4.1|avx2|table] in [out]\n",name);
+}
+
+static int engineByName(const char *name) {
+  if (strcmp(name,"scalar") == 0) return SPIDER_CIPHER_ENGINE_SCALAR;
+  if (strcmp(name,"sse4.1") == 0) return SPIDER_CIPHER_ENGINE_SSE41;
+  if (strcmp(name,"avx2") == 0) return SPIDER_CIPHER_ENGINE_AVX2;
+  if (strcmp(name,"table") == 0) return SPIDER_CIPHER_ENGINE_TABLE;
+  return -1;
+}
+
+static int readKey(const char *file, Card key[CARDS]) {
+  FILE *f = fopen(file,"rb");
+  if (f == NULL) return 0;
+  size_t n = fread(key,1,CARDS,f);
+  int extra = fgetc(f);
+  fclose(f);
+  return n == CARDS && extra == EOF;
+}
+
+static void advise(void *data, size_t size) {
+  madvise(data,size,MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+  madvise(data,size,MADV_HUGEPAGE);
+#endif
+}
+
+// offset of the first byte of cards[0..n-1] that is not a card, or n.
+static size_t badCard(const Card *cards, size_t n) {
+  Card any = 0;
+  for (size_t i=0; i<n; ++i) {
+    any |= (Card) (cards[i] >= CARDS);
+  }
+  if (!any) return n;
+  for (size_t i=0; i<n; ++i) {
+    if (cards[i] >= CARDS) return i;
+  }
+  return n;
+}
+
+// in and out are the same file (out may not exist yet).
+static int sameFile(const char *inFile, const char *outFile) {
+  struct stat inSt, outSt;
+  if (stat(inFile,&inSt) != 0 || stat(outFile,&outSt) != 0) return 0;
+  return inSt.st_dev == outSt.st_dev && inSt.st_ino == outSt.st_ino;
+}
+
+// Feed the size cards of in to the session into out (in == out in
+// place), both open, out already size bytes.
+static int feedFile(const char *name, SpiderCipherSession *session,
+		    const char *inFile, int in,
+		    const char *outFile, int out,
+		    size_t size) {
+  int inPlace = in == out;
+  Card *inCards = (Card*) mmap(NULL,size,
+			       inPlace ? PROT_READ | PROT_WRITE : PROT_READ,
+			       MAP_SHARED,in,0);
+  if (inCards == MAP_FAILED) {
+    perror(inFile);
+    return 1;
+  }
+  Card *outCards = inCards;
+  if (!inPlace) {
+    outCards = (Card*) mmap(NULL,size,PROT_READ | PROT_WRITE,MAP_SHARED,out,0);
+    if (outCards == MAP_FAILED) {
+      perror(outFile);
+      munmap(inCards,size);
+      return 1;
+    }
+    advise(outCards,size);
+  }
+  advise(inCards,size);
+
+  // in place nothing is fed unless every card is good.
+  size_t bad = inPlace ? badCard(inCards,size) : size;
+  for (size_t at=0; bad == size && at<size; at += CHUNK) {
+    size_t n = size-at < CHUNK ? size-at : CHUNK;
+    size_t good = inPlace ? n : badCard(inCards+at,n);
+    SpiderCipherSessionFeed(session,inCards+at,outCards+at,good);
+    if (good < n) bad = at+good;
+  }
+
+  int status = 0;
+  if (bad < size) {
+    fprintf(stderr,"%s: byte %zu of %s is %d, not a card 0..%d\n",
+	    name,bad,inFile,inCards[bad],CARDS-1);
+    status = 2;
+  }
+  if (!inPlace) munmap(outCards,size);
+  munmap(inCards,size);
+  if (!inPlace && bad < size && ftruncate(out,(off_t) bad) != 0) {
+    perror(outFile);
+    status = 1;
+  }
+  return status;
+}
+
+// Open in and out (out == NULL in place) and feed in to the session.
+static int feedFiles(const char *name, SpiderCipherSession *session,
+		     const char *inFile, const char *outFile) {
+  int inPlace = outFile == NULL || sameFile(inFile,outFile);
+  int in = open(inFile,inPlace ? O_RDWR : O_RDONLY);
+  if (in < 0) {
+    perror(inFile);
+    return 1;
+  }
+  struct stat st;
+  if (fstat(in,&st) != 0) {
+    perror(inFile);
+    close(in);
+    return 1;
+  }
+  size_t size = (size_t) st.st_size;
+
+  int out = in;
+  if (!inPlace) {
+    out = open(outFile,O_RDWR | O_CREAT | O_TRUNC,0644);
+    if (out < 0 || ftruncate(out,st.st_size) != 0) {
+      perror(outFile);
+      if (out >= 0) close(out);
+      close(in);
+      return 1;
+    }
+  }
+
+  int status = size > 0 ? feedFile(name,session,inFile,in,outFile,out,size) : 0;
+  if (!inPlace && close(out) != 0) {
+    perror(outFile);
+    status = 1;
+  }
+  close(in);
+  return status;
+}
+
+int main(int argc, const char *argv[]) {
+  const char *keyFile = NULL, *inFile = NULL, *outFile = NULL;
+  int unscramble = -1, engine = SPIDER_CIPHER_ENGINE_AUTO;
+
+  for (int argi=1; argi<argc; ++argi) {
+    const char *arg = argv[argi];
+    if (strcmp(arg,"--scramble") == 0) {
+      unscramble = 0;
+    } else if (strcmp(arg,"--unscramble") == 0) {
+      unscramble = 1;
+    } else if (strncmp(arg,"--key=",6) == 0) {
+      keyFile = arg+6;
+    } else if (strncmp(arg,"--engine=",9) == 0) {
+      engine = engineByName(arg+9);
+      if (engine < 0) {
+	usage(argv[0]);
+	return 1;
+      }
+    } else if (arg[0] == '-' && arg[1] == '-') {
+      usage(argv[0]);
+      return 1;
+    } else if (inFile == NULL) {
+      inFile = arg;
+    } else if (outFile == NULL) {
+      outFile = arg;
+    } else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (unscramble < 0 || keyFile == NULL || inFile == NULL) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  if (engine != SPIDER_CIPHER_ENGINE_AUTO && !SpiderCipherEngineSelect(engine)) {
+    fprintf(stderr,"%s: engine not available on this cpu\n",argv[0]);
+    return 1;
+  }
+
+  Card key[CARDS];
+  SpiderCipherSession session;
+  if (!readKey(keyFile,key)) {
+    fprintf(stderr,"%s: %s is not %d key cards\n",argv[0],keyFile,CARDS);
+    return 1;
+  }
+  int status = 1;
+  if (SpiderCipherSessionInit(&session,key,unscramble)) {
+    status = feedFiles(argv[0],&session,inFile,outFile);
+  } else {
+    fprintf(stderr,"%s: %s is not a permutation of 0..%d\n",argv[0],keyFile,CARDS-1);
+  }
+  memset(key,0,sizeof(key));
+  SpiderCipherSessionFinish(&session);
+  return status;
+}
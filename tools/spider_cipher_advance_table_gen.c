@@ -0,0 +1,44 @@
+#include <stdio.h>
+#include <stdint.h>
+
+//
+// Writes the C source of SPIDER_CIPHER_ADVANCE_TABLE to stdout:
+//
+//   SPIDER_CIPHER_ADVANCE_TABLE[tagAt][cutAt][at]
+//
+// is where the card that ends up at at came from when the deck is
+// cut at tagAt, back-front shuffled, and cut at cutAt of the
+// shuffled deck (the SpiderCipherCutShuffleCutDeck map), so the
+// table engine advances a deck with one gather pass.
+//
+// The build runs this, so nothing is computed at startup and the
+// 64K of output is never checked in.
+//
+
+#define CARDS 40
+
+int main(int argc, const char *argv[]) {
+  uint8_t backFront[CARDS];
+  for (int at=0; at<CARDS; ++at) {
+    backFront[at] = at < CARDS/2 ? CARDS-1-2*at : 2*(at-CARDS/2);
+  }
+
+  printf("// generated by tools/spider_cipher_advance_table_gen.c, do not edit.\n\n");
+  printf("#include <stdint.h>\n\n");
+  printf("const uint8_t SPIDER_CIPHER_ADVANCE_TABLE[%d][%d][%d] =\n  {\n",
+	 CARDS,CARDS,CARDS);
+  for (int tagAt=0; tagAt<CARDS; ++tagAt) {
+    printf("   {\n");
+    for (int cutAt=0; cutAt<CARDS; ++cutAt) {
+      printf("    {");
+      for (int at=0; at<CARDS; ++at) {
+	int from = (backFront[(at+cutAt) % CARDS]+tagAt) % CARDS;
+	printf("%d%s",from,at+1<CARDS ? "," : "");
+      }
+      printf("}%s\n",cutAt+1<CARDS ? "," : "");
+    }
+    printf("   }%s\n",tagAt+1<CARDS ? "," : "");
+  }
+  printf("  };\n");
+  return ferror(stdout) ? 1 : 0;
+}